@@ -0,0 +1,197 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbCameraMath.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbCameraMath, Log, All);
+
+FVector FClimbCameraMath::InterpToPerAxis(const FVector& Current, const FVector& Target, const FVector& Speeds, float DeltaTime)
+{
+	const VectorRegister4Double CurrentRegister = VectorLoadFloat3(&Current.X);
+	const VectorRegister4Double TargetRegister = VectorLoadFloat3(&Target.X);
+	const VectorRegister4Double SpeedRegister = VectorLoadFloat3(&Speeds.X);
+	const VectorRegister4Double DeltaTimeRegister = MakeVectorRegisterDouble((double)DeltaTime, (double)DeltaTime, (double)DeltaTime, (double)DeltaTime);
+	const VectorRegister4Double SmallNumber = MakeVectorRegisterDouble(UE_SMALL_NUMBER, UE_SMALL_NUMBER, UE_SMALL_NUMBER, UE_SMALL_NUMBER);
+
+	VectorRegister4Double Distance = VectorSubtract(TargetRegister, CurrentRegister);
+	VectorRegister4Double Alpha = VectorMin(VectorMax(VectorMultiply(DeltaTimeRegister, SpeedRegister), GlobalVectorConstants::DoubleZero), GlobalVectorConstants::DoubleOne);
+	VectorRegister4Double Result = VectorMultiplyAdd(Distance, Alpha, CurrentRegister);
+
+	//Same early outs as FInterpTo, axes without a speed or already there snap to the target
+	VectorRegister4Double Snap = VectorBitwiseOr(VectorCompareLE(SpeedRegister, GlobalVectorConstants::DoubleZero), VectorCompareLT(VectorMultiply(Distance, Distance), SmallNumber));
+	Result = VectorSelect(Snap, TargetRegister, Result);
+
+	FVector Out;
+	VectorStoreFloat3(Result, &Out.X);
+	return Out;
+}
+
+FVector FClimbCameraMath::SpringPerAxis(const FVector& Current, const FVector& Target, FVector& InOutVelocity, const FVector& Speeds, float DeltaTime)
+{
+	const VectorRegister4Double CurrentRegister = VectorLoadFloat3(&Current.X);
+	const VectorRegister4Double TargetRegister = VectorLoadFloat3(&Target.X);
+	const VectorRegister4Double VelocityRegister = VectorLoadFloat3(&InOutVelocity.X);
+	const VectorRegister4Double Omega = VectorLoadFloat3(&Speeds.X);
+	const VectorRegister4Double DeltaTimeRegister = MakeVectorRegisterDouble((double)DeltaTime, (double)DeltaTime, (double)DeltaTime, (double)DeltaTime);
+
+	//Exact decay exp(-Omega * DeltaTime) approximated as 1 / (1 + x + 0.48x^2 + 0.235x^3), good for any step size
+	VectorRegister4Double X = VectorMultiply(Omega, DeltaTimeRegister);
+	VectorRegister4Double Denominator = VectorMultiplyAdd(X, MakeVectorRegisterDouble(0.235, 0.235, 0.235, 0.235), MakeVectorRegisterDouble(0.48, 0.48, 0.48, 0.48));
+	Denominator = VectorMultiplyAdd(X, Denominator, GlobalVectorConstants::DoubleOne);
+	Denominator = VectorMultiplyAdd(X, Denominator, GlobalVectorConstants::DoubleOne);
+	VectorRegister4Double Decay = VectorDivide(GlobalVectorConstants::DoubleOne, Denominator);
+
+	VectorRegister4Double Change = VectorSubtract(CurrentRegister, TargetRegister);
+	VectorRegister4Double Temp = VectorMultiply(VectorMultiplyAdd(Omega, Change, VelocityRegister), DeltaTimeRegister);
+	VectorRegister4Double NewVelocity = VectorMultiply(VectorSubtract(VelocityRegister, VectorMultiply(Omega, Temp)), Decay);
+	VectorRegister4Double Result = VectorMultiplyAdd(VectorAdd(Change, Temp), Decay, TargetRegister);
+
+	//Axes without a speed snap to the target like FInterpTo does
+	VectorRegister4Double Snap = VectorCompareLE(Omega, GlobalVectorConstants::DoubleZero);
+	Result = VectorSelect(Snap, TargetRegister, Result);
+	NewVelocity = VectorSelect(Snap, GlobalVectorConstants::DoubleZero, NewVelocity);
+
+	FVector Out;
+	VectorStoreFloat3(Result, &Out.X);
+	VectorStoreFloat3(NewVelocity, &InOutVelocity.X);
+	return Out;
+}
+
+int32 FClimbCameraMath::GetNumSubsteps(float DeltaTime, float MaxSubstepTime, int32 MaxSubsteps)
+{
+	if (MaxSubstepTime <= 0 || DeltaTime <= MaxSubstepTime)
+		return 1;
+
+	return FMath::Clamp(FMath::CeilToInt(DeltaTime / MaxSubstepTime), 1, MaxSubsteps);
+}
+
+FVector FClimbCameraMath::AxisIndependentLag(const FVector& Current, const FVector& Target, const FQuat& Space, const FVector& LagSpeeds, float DeltaTime, float MaxSubstepTime, FVector* InOutVelocity)
+{
+	FVector LocalCurrent = Space.UnrotateVector(Current);
+	FVector LocalTarget = Space.UnrotateVector(Target);
+
+	int32 NumSubsteps = GetNumSubsteps(DeltaTime, MaxSubstepTime);
+	float SubstepTime = DeltaTime / NumSubsteps;
+
+	if (InOutVelocity != nullptr)
+	{
+		//The velocity is kept in world space, so it stays right when Space turns between frames
+		FVector LocalVelocity = Space.UnrotateVector(*InOutVelocity);
+
+		for (int32 Substep = 0; Substep < NumSubsteps; Substep++)
+		{
+			LocalCurrent = SpringPerAxis(LocalCurrent, LocalTarget, LocalVelocity, LagSpeeds, SubstepTime);
+		}
+
+		*InOutVelocity = Space.RotateVector(LocalVelocity);
+	}
+	else
+	{
+		for (int32 Substep = 0; Substep < NumSubsteps; Substep++)
+		{
+			LocalCurrent = InterpToPerAxis(LocalCurrent, LocalTarget, LagSpeeds, SubstepTime);
+		}
+	}
+
+	return Space.RotateVector(LocalCurrent);
+}
+
+/** The scalar lag AClimbCustomCameraManager::CalculateAxisIndependentLag used before, kept as the benchmark baseline. */
+static FVector ScalarAxisIndependentLag(const FVector& CurrentLocation, const FVector& TargetLocation, const FRotator& CameraRotation, const FVector& LagSpeeds, float DeltaTime)
+{
+	FRotator CameraRotationYaw = FRotator(0, 0, CameraRotation.Yaw);
+
+	FVector UnrotateCurrentLocation = CameraRotationYaw.UnrotateVector(CurrentLocation);
+	FVector UnrotateTargetLocation = CameraRotationYaw.UnrotateVector(TargetLocation);
+
+	float LerpX = FMath::FInterpTo(UnrotateCurrentLocation.X, UnrotateTargetLocation.X, DeltaTime, LagSpeeds.X);
+	float LerpY = FMath::FInterpTo(UnrotateCurrentLocation.Y, UnrotateTargetLocation.Y, DeltaTime, LagSpeeds.Y);
+	float LerpZ = FMath::FInterpTo(UnrotateCurrentLocation.Z, UnrotateTargetLocation.Z, DeltaTime, LagSpeeds.Z);
+
+	return CameraRotationYaw.RotateVector(FVector(LerpX, LerpY, LerpZ));
+}
+
+static void RunCameraLagBenchmark(const TArray<FString>& Args)
+{
+	int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+	struct FLagInput
+	{
+		FVector Current;
+		FVector Target;
+		FRotator Rotation;
+		FVector Speeds;
+		float DeltaTime;
+	};
+
+	//Inputs like a pivot a few meters into the level with the usual curve speeds
+	FRandomStream Random(1234);
+	TArray<FLagInput> Inputs;
+	Inputs.SetNum(1024);
+	for (FLagInput& Input : Inputs)
+	{
+		Input.Current = Random.GetUnitVector() * Random.FRandRange(0, 5000);
+		Input.Target = Input.Current + Random.GetUnitVector() * Random.FRandRange(0, 200);
+		Input.Rotation = FRotator(Random.FRandRange(-80, 80), Random.FRandRange(-180, 180), 0);
+		Input.Speeds = FVector(Random.FRandRange(0, 20), Random.FRandRange(0, 20), Random.FRandRange(0, 20));
+		Input.DeltaTime = Random.FRandRange(1.0f / 240, 1.0f / 30);
+	}
+
+	double MaxDifference = 0;
+	for (const FLagInput& Input : Inputs)
+	{
+		FVector Scalar = ScalarAxisIndependentLag(Input.Current, Input.Target, Input.Rotation, Input.Speeds, Input.DeltaTime);
+		FVector Vectorized = FClimbCameraMath::AxisIndependentLag(Input.Current, Input.Target, FRotator(0, 0, Input.Rotation.Yaw).Quaternion(), Input.Speeds, Input.DeltaTime);
+		MaxDifference = FMath::Max(MaxDifference, FVector::Dist(Scalar, Vectorized));
+	}
+
+	auto Measure = [&Inputs, Iterations](auto&& Lag)
+	{
+		FVector Checksum = FVector::ZeroVector;
+		double StartTime = FPlatformTime::Seconds();
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			const FLagInput& Input = Inputs[Iteration & (1024 - 1)];
+			Checksum += Lag(Input);
+		}
+
+		double Nanoseconds = (FPlatformTime::Seconds() - StartTime) * 1e9 / Iterations;
+		return TPair<double, FVector>(Nanoseconds, Checksum);
+	};
+
+	auto Scalar = Measure([](const FLagInput& Input)
+	{
+		return ScalarAxisIndependentLag(Input.Current, Input.Target, Input.Rotation, Input.Speeds, Input.DeltaTime);
+	});
+
+	auto Vectorized = Measure([](const FLagInput& Input)
+	{
+		return FClimbCameraMath::AxisIndependentLag(Input.Current, Input.Target, FRotator(0, 0, Input.Rotation.Yaw).Quaternion(), Input.Speeds, Input.DeltaTime);
+	});
+
+	auto Spring = Measure([](const FLagInput& Input)
+	{
+		FVector Velocity = FVector::ZeroVector;
+		return FClimbCameraMath::AxisIndependentLag(Input.Current, Input.Target, FRotator(0, 0, Input.Rotation.Yaw).Quaternion(), Input.Speeds, Input.DeltaTime, 0, &Velocity);
+	});
+
+	auto SpringSubstepped = Measure([](const FLagInput& Input)
+	{
+		FVector Velocity = FVector::ZeroVector;
+		return FClimbCameraMath::AxisIndependentLag(Input.Current, Input.Target, FRotator(0, 0, Input.Rotation.Yaw).Quaternion(), Input.Speeds, Input.DeltaTime, 1.0f / 120, &Velocity);
+	});
+
+	UE_LOG(LogClimbCameraMath, Display, TEXT("Camera lag over %d iterations, ns per call: scalar %.1f, vectorized %.1f, spring %.1f, spring substepped at 120 Hz %.1f"),
+		Iterations, Scalar.Key, Vectorized.Key, Spring.Key, SpringSubstepped.Key);
+	UE_LOG(LogClimbCameraMath, Display, TEXT("Largest difference between scalar and vectorized lag: %f (checksums %s %s %s %s)"),
+		MaxDifference, *Scalar.Value.ToString(), *Vectorized.Value.ToString(), *Spring.Value.ToString(), *SpringSubstepped.Value.ToString());
+}
+
+static FAutoConsoleCommand RunCameraLagBenchmarkCommand(
+	TEXT("Climb.CameraLagBenchmark"),
+	TEXT("Climb.CameraLagBenchmark [Iterations]: times the scalar camera lag against the vectorized and spring versions and logs the results"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunCameraLagBenchmark)
+);
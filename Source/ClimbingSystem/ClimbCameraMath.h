@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Camera smoothing kernels that work on all three axes of a vector at once in vector registers.
+ * DeltaTime is handed in once by the caller instead of being queried per call.
+ */
+struct CLIMBINGSYSTEM_API FClimbCameraMath
+{
+	/** FMath::FInterpTo on each axis with its own speed. */
+	static FVector InterpToPerAxis(const FVector& Current, const FVector& Target, const FVector& Speeds, float DeltaTime);
+
+	/**
+	 * Critically damped spring on each axis, Speeds is the spring's angular frequency and settles about as fast as the same FInterpTo speed.
+	 * InOutVelocity carries the spring between calls.
+	 */
+	static FVector SpringPerAxis(const FVector& Current, const FVector& Target, FVector& InOutVelocity, const FVector& Speeds, float DeltaTime);
+
+	/** Number of equal substeps of at most MaxSubstepTime DeltaTime is split into, 1 when MaxSubstepTime is 0. */
+	static int32 GetNumSubsteps(float DeltaTime, float MaxSubstepTime, int32 MaxSubsteps = 8);
+
+	/**
+	 * Lags Current behind Target separately along each axis of Space. Uses the spring when InOutVelocity is given, FInterpTo otherwise,
+	 * in substeps of at most MaxSubstepTime so the result hardly depends on the frame rate.
+	 */
+	static FVector AxisIndependentLag(const FVector& Current, const FVector& Target, const FQuat& Space, const FVector& LagSpeeds, float DeltaTime, float MaxSubstepTime = 0, FVector* InOutVelocity = nullptr);
+};
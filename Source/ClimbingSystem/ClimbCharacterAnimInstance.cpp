@@ -2,3 +2,27 @@
 
 
 #include "ClimbCharacterAnimInstance.h"
+
+void FClimbAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds)
+{
+	Super::PreUpdate(InAnimInstance, DeltaSeconds);
+
+	ClimbAnimData = CastChecked<UClimbCharacterAnimInstance>(InAnimInstance)->PendingClimbAnimData;
+}
+
+FAnimInstanceProxy* UClimbCharacterAnimInstance::CreateAnimInstanceProxy()
+{
+	return &ClimbAnimInstanceProxy;
+}
+
+void UClimbCharacterAnimInstance::DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy)
+{
+	//The proxy is a member, nothing to free
+}
+
+void UClimbCharacterAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	ClimbAnimData = GetProxyOnAnyThread<FClimbAnimInstanceProxy>().ClimbAnimData;
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "Animation/AnimInstanceProxy.h"
 #include "IAnimInt.h"
 #include "ClimbCharacterAnimInstance.generated.h"
 
@@ -19,6 +20,61 @@ enum class EClimbingDirection : uint8
 	Direction_DownLeft,
 	Direction_DownRight
 };
+/** Climb data UClimbComponent hands to the anim instance every tick. */
+USTRUCT(BlueprintType)
+struct FClimbAnimData
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	UPROPERTY(BlueprintReadOnly)
+	UClimbState ClimbState = UClimbState::Default;
+
+	UPROPERTY(BlueprintReadOnly)
+	float Direction = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector2D Input = FVector2D::ZeroVector;
+
+	/** Surface the character is attached to, pointing away from it. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector LedgeNormal = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector LedgeLocation = FVector::ZeroVector;
+
+	/** World space IK targets, set through UClimbComponent::SetClimbIKTargets. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector LeftHandIKTarget = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector RightHandIKTarget = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector LeftFootIKTarget = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector RightFootIKTarget = FVector::ZeroVector;
+};
+
+/** Carries the climb data of UClimbCharacterAnimInstance across to the worker thread animation update. */
+USTRUCT()
+struct CLIMBINGSYSTEM_API FClimbAnimInstanceProxy : public FAnimInstanceProxy
+{
+	GENERATED_BODY()
+public:
+	FClimbAnimInstanceProxy() = default;
+
+	FClimbAnimInstanceProxy(UAnimInstance* InAnimInstance)
+		: FAnimInstanceProxy(InAnimInstance)
+	{
+	}
+
+	FClimbAnimData ClimbAnimData;
+
+protected:
+	virtual void PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds) override;
+};
+
 /**
  * 
  */
@@ -26,4 +82,21 @@ UCLASS()
 class CLIMBINGSYSTEM_API UClimbCharacterAnimInstance : public UAnimInstance, public IIAnimInt
 {
 	GENERATED_BODY()
+
+public:
+	/** Written by UClimbComponent on the game thread, copied into the proxy before every animation update. */
+	FClimbAnimData PendingClimbAnimData;
+
+protected:
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	/** Climb data of the current animation update, safe to read from worker threads. */
+	UPROPERTY(BlueprintReadOnly, Category = Climb)
+	FClimbAnimData ClimbAnimData;
+
+private:
+	UPROPERTY(Transient)
+	FClimbAnimInstanceProxy ClimbAnimInstanceProxy;
 };
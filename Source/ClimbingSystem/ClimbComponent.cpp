@@ -8,6 +8,77 @@
 #include "Math/UnrealMathUtility.h"
 #include "Components/CapsuleComponent.h"
 #include "TraceBlueprintFunctionLibrary.h"
+#include "Engine/Private/KismetTraceUtils.h"
+#include "SignificanceManager.h"
+#include "ClimbFeatureIndex.h"
+#include "ClimbFeatureCacheSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "ClimbCharacterAnimInstance.h"
+#include "ClimbTraceBudgetSubsystem.h"
+#include "ClimbStats.h"
+#include "ClimbTelemetry.h"
+#include "ClimbInputRecording.h"
+#include "ClimbProbeSet.h"
+#include "ClimbProbeSubsystem.h"
+#include "ClimbZipLineSubsystem.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbComponent, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_Climb_Tick, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick Default"), STAT_Climb_TickDefault, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick Climbing"), STAT_Climb_TickClimbing, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick ClimbingPipe"), STAT_Climb_TickClimbingPipe, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick Hanging"), STAT_Climb_TickHanging, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick Balance"), STAT_Climb_TickBalance, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick NarrowSpace"), STAT_Climb_TickNarrowSpace, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick LedgeWalk"), STAT_Climb_TickLedgeWalk, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Tick ZipLine"), STAT_Climb_TickZipLine, STATGROUP_Climbing);
+
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckDefault"), STAT_Climb_ObstacleCheckDefault, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckDefaultByInput"), STAT_Climb_ObstacleCheckDefaultByInput, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckClimbing"), STAT_Climb_ObstacleCheckClimbing, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckClimbPipe"), STAT_Climb_ObstacleCheckClimbPipe, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckHanging"), STAT_Climb_ObstacleCheckHanging, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckBalance"), STAT_Climb_ObstacleCheckBalance, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckNarrowSpace"), STAT_Climb_ObstacleCheckNarrowSpace, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ObstacleCheckLedgeWalk"), STAT_Climb_ObstacleCheckLedgeWalk, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("DefaultObstacleCheck"), STAT_Climb_DefaultObstacleCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("DefaultFloorCheck"), STAT_Climb_DefaultFloorCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("DefaultNarrowSpaceCheck"), STAT_Climb_DefaultNarrowSpaceCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("IssueAsyncDetectionProbes"), STAT_Climb_IssueAsyncDetectionProbes, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbRightCornerInnerCheck"), STAT_Climb_ClimbRightCornerInnerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbLeftCornerInnerCheck"), STAT_Climb_ClimbLeftCornerInnerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HangingRightCornerInnerCheck"), STAT_Climb_HangingRightCornerInnerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HangingLeftCornerInnerCheck"), STAT_Climb_HangingLeftCornerInnerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbRightCornerOuterCheck"), STAT_Climb_ClimbRightCornerOuterCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbLeftCornerOuterCheck"), STAT_Climb_ClimbLeftCornerOuterCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HangingRightCornerOuterCheck"), STAT_Climb_HangingRightCornerOuterCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HangingLeftCornerOuterCheck"), STAT_Climb_HangingLeftCornerOuterCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("LedgeWalkUpInsideCornerCheck"), STAT_Climb_LedgeWalkUpInsideCornerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("LedgeWalkDownInsideCornerCheck"), STAT_Climb_LedgeWalkDownInsideCornerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("LedgeWalkUpOutwardCornerCheck"), STAT_Climb_LedgeWalkUpOutwardCornerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("LedgeWalkDownOutwardCornerCheck"), STAT_Climb_LedgeWalkDownOutwardCornerCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbRightJumpCheck"), STAT_Climb_ClimbRightJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbLeftJumpCheck"), STAT_Climb_ClimbLeftJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbDownJumpCheck"), STAT_Climb_ClimbDownJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbUpJumpCheck"), STAT_Climb_ClimbUpJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbPipeRightJumpCheck"), STAT_Climb_ClimbPipeRightJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("ClimbPipeLeftJumpCheck"), STAT_Climb_ClimbPipeLeftJumpCheck, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleClimbLerpTransfor"), STAT_Climb_HandleClimbLerpTransfor, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleClimbPipeLerpTransfor"), STAT_Climb_HandleClimbPipeLerpTransfor, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleHangingLerpTransfor"), STAT_Climb_HandleHangingLerpTransfor, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleBalanceLerpTransfor"), STAT_Climb_HandleBalanceLerpTransfor, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleNarrowSpaceLerpTransfor"), STAT_Climb_HandleNarrowSpaceLerpTransfor, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("HandleLedgeWalkLerpTransfor"), STAT_Climb_HandleLedgeWalkLerpTransfor, STATGROUP_Climbing);
+
+CSV_DEFINE_CATEGORY(Climbing, true);
+
+static const FName ClimbSignificanceTag(TEXT("ClimbComponent"));
 
 float GHangingTraceOffsetZ = 24;
 
@@ -27,6 +98,79 @@ static FAutoConsoleVariableRef CVarNarrowSpaceTraceLength(
 	ECVF_Default
 );
 
+static void DumpClimbStats(UWorld* World)
+{
+	for (TObjectIterator<UClimbComponent> It; It; ++It)
+	{
+		if (It->GetWorld() != World)
+			continue;
+
+		UE_LOG(LogClimbComponent, Display, TEXT("%s: %s"), *GetNameSafe(It->GetOwner()), *It->GetTelemetry().ToString());
+	}
+}
+
+static FAutoConsoleCommandWithWorld DumpClimbStatsCommand(
+	TEXT("Climb.DumpStats"),
+	TEXT("Logs the rolling climb telemetry of every climbing character"),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&DumpClimbStats)
+);
+
+static UClimbComponent* FindLocalClimbComponent(UWorld* World)
+{
+	for (TObjectIterator<UClimbComponent> It; It; ++It)
+	{
+		if (It->GetWorld() != World)
+			continue;
+
+		APawn* Pawn = Cast<APawn>(It->GetOwner());
+		if (Pawn != nullptr && Pawn->IsLocallyControlled())
+			return *It;
+	}
+	return nullptr;
+}
+
+static void RecordClimbInput(const TArray<FString>& Args, UWorld* World)
+{
+	if (UClimbComponent* ClimbComponent = FindLocalClimbComponent(World))
+	{
+		ClimbComponent->StartInputRecording();
+	}
+}
+
+static void StopRecordClimbInput(const TArray<FString>& Args, UWorld* World)
+{
+	if (UClimbComponent* ClimbComponent = FindLocalClimbComponent(World))
+	{
+		ClimbComponent->StopInputRecording(FClimbInputRecording::GetRecordingPath(Args.Num() > 0 ? Args[0] : TEXT("Default")));
+	}
+}
+
+static void ReplayClimbInput(const TArray<FString>& Args, UWorld* World)
+{
+	if (UClimbComponent* ClimbComponent = FindLocalClimbComponent(World))
+	{
+		ClimbComponent->StartInputReplay(FClimbInputRecording::GetRecordingPath(Args.Num() > 0 ? Args[0] : TEXT("Default")));
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs RecordClimbInputCommand(
+	TEXT("Climb.RecordInput"),
+	TEXT("Starts recording the climb input of the local character"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RecordClimbInput)
+);
+
+static FAutoConsoleCommandWithWorldAndArgs StopRecordClimbInputCommand(
+	TEXT("Climb.StopRecordInput"),
+	TEXT("Climb.StopRecordInput [Name]: saves the climb input recorded since Climb.RecordInput to Saved/ClimbRecordings"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StopRecordClimbInput)
+);
+
+static FAutoConsoleCommandWithWorldAndArgs ReplayClimbInputCommand(
+	TEXT("Climb.ReplayInput"),
+	TEXT("Climb.ReplayInput [Name]: replays a climb input recording on the local character, -ClimbReplayExit quits when it ends"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ReplayClimbInput)
+);
+
 // Sets default values for this component's properties
 UClimbComponent::UClimbComponent()
 {
@@ -35,6 +179,11 @@ UClimbComponent::UClimbComponent()
 	PrimaryComponentTick.bCanEverTick = true;
 
 	// ...
+
+	FClimbDetectionRate DefaultDetectionRate;
+	DefaultDetectionRate.IdleInterval = 0.1;
+	DefaultDetectionRate.InsignificantInterval = 0.2;
+	DetectionRates.Add(UClimbState::Default, DefaultDetectionRate);
 }
 
 
@@ -49,6 +198,7 @@ void UClimbComponent::BeginPlay()
 	if (OwnerCharacter != nullptr)
 	{
 		ClimbingAnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance();
+		CacheAnimInstanceBinding();
 		ClimbingInputComponent = OwnerCharacter->InputComponent;
 
 		ClimbingMovementComponent = Cast<UCharacterMovementComponent>(OwnerCharacter->GetMovementComponent());
@@ -61,7 +211,8 @@ void UClimbComponent::BeginPlay()
 		return;
 	}
 
-	if (UEnhancedInputComponent* ClimbingEnhancedInputComponent = CastChecked<UEnhancedInputComponent>(ClimbingInputComponent))
+	//AI controlled characters have no input component, they are driven through SetScriptedMoveInput and SetScriptedJump
+	if (UEnhancedInputComponent* ClimbingEnhancedInputComponent = Cast<UEnhancedInputComponent>(ClimbingInputComponent))
 	{
 		ClimbingEnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &UClimbComponent::Move);
 		ClimbingEnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &UClimbComponent::JumpPressed);
@@ -69,7 +220,7 @@ void UClimbComponent::BeginPlay()
 		ClimbingEnhancedInputComponent->BindAction(CrouchAction, ETriggerEvent::Started, this, &UClimbComponent::CrouchPressed);
 		ClimbingEnhancedInputComponent->BindAction(CrouchAction, ETriggerEvent::Completed, this, &UClimbComponent::CrouchReleased);
 	}
-	else
+	else if (ClimbingInputComponent != nullptr)
 	{
 		return;
 	}
@@ -80,37 +231,147 @@ void UClimbComponent::BeginPlay()
 		MotionWarpingComponent = Cast<UMotionWarpingComponent>(OwnerCharacter->AddComponentByClass(UMotionWarpingComponent::StaticClass(), false, FTransform(), false));
 	}
 
+	MontageRandomStream.GenerateNewSeed();
+
+	DetectionQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(ClimbDetection), false);
+
+	DetectionIgnoreOwnerQueryParams = DetectionQueryParams;
+	DetectionIgnoreOwnerQueryParams.AddIgnoredActor(OwnerCharacter);
+
+	AsyncDetectionTraceDelegate.BindUObject(this, &UClimbComponent::OnAsyncDetectionTraceDone);
+
+	if (bUseClimbFeatureIndex && ClimbFeatureIndex == nullptr)
+	{
+		ClimbFeatureIndex = UClimbFeatureIndex::LoadForWorld(GetWorld());
+	}
+
+	if (bUseClimbFeatureCache)
+	{
+		ClimbFeatureCache = GetWorld()->GetSubsystem<UClimbFeatureCacheSubsystem>();
+	}
+
+	TraceBudget = GetWorld()->GetSubsystem<UClimbTraceBudgetSubsystem>();
+	ProbeSubsystem = GetWorld()->GetSubsystem<UClimbProbeSubsystem>();
+	if (ProbeSubsystem != nullptr)
+	{
+		ProbeSubsystem->RegisterClimber(this);
+	}
+	ZipLineSubsystem = GetWorld()->GetSubsystem<UClimbZipLineSubsystem>();
+
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->RegisterObject(this, ClimbSignificanceTag,
+			[](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+			{
+				return CastChecked<UClimbComponent>(ObjectInfo->GetObject())->CalculateSignificance(Viewpoint);
+			},
+			USignificanceManager::EPostSignificanceType::Sequential,
+			[](USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float Significance, bool bFinal)
+			{
+				CastChecked<UClimbComponent>(ObjectInfo->GetObject())->DetectionSignificance = Significance;
+			});
+	}
+
+	UpdateMontageStreaming();
+
 	bComponentInitalize = true;
 }
 
+void UClimbComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(this);
+	}
+
+	if (TraceBudget != nullptr)
+	{
+		TraceBudget->CancelDetection(this);
+	}
+
+	if (ProbeSubsystem != nullptr)
+	{
+		ProbeSubsystem->UnregisterClimber(this);
+	}
+
+	if (MontageStreamingHandle.IsValid())
+	{
+		MontageStreamingHandle->ReleaseHandle();
+		MontageStreamingHandle.Reset();
+	}
+
+	OnMontageStreamingLoaded();
+
+	if (DefaultMontageStreamingHandle.IsValid())
+	{
+		DefaultMontageStreamingHandle->ReleaseHandle();
+		DefaultMontageStreamingHandle.Reset();
+	}
+
+	StopInputReplay();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UClimbComponent::Move(const FInputActionValue& Value)
 {
+	if (IsReplayingInput())
+		return;
+
 	MovementInput = Value.Get<FVector2D>();
 }
 
 void UClimbComponent::JumpPressed()
 {
+	if (IsReplayingInput())
+		return;
+
 	JumpState = UJumpState::Presse;
 }
 
 void UClimbComponent::JumpReleased()
 {
+	if (IsReplayingInput())
+		return;
+
 	JumpState = UJumpState::Release;
 }
 
+void UClimbComponent::SetScriptedMoveInput(FVector2D Input)
+{
+	Move(FInputActionValue(Input));
+}
+
+void UClimbComponent::SetScriptedJump(bool bPressed)
+{
+	if (bPressed)
+		JumpPressed();
+	else
+		JumpReleased();
+}
+
 void UClimbComponent::CrouchPressed()
 {
 	if(!bComponentInitalize)
 		return;
 
+	if (IsReplayingInput() && !bApplyingReplayFrame)
+		return;
+
+	if (bRecordingInput)
+		PendingCrouchFlags |= FClimbInputFrame::CrouchPressed;
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
+	//Input arrives outside of TickComponent, route the slide traces to this character as well
+	FClimbTelemetryScope TelemetryScope(&Telemetry);
+
 	FVector CharacterVelociy = ClimbingMovementComponent->Velocity;
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterLocation = GetFrameContext().Location;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 
 	if(ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Walking &&
 	   ClimbState == UClimbState::Default)
@@ -121,7 +382,8 @@ void UClimbComponent::CrouchPressed()
 
 		FVector SliderDownPathTraceStart = GetFootLocation() + FVector::UpVector * 40;
 		FVector SliderDownPathTraceEnd = SliderDownPathTraceStart + CharacterForwardVector * 500;
-		FHitResult SliderDownPathTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, SliderDownPathTraceStart, SliderDownPathTraceEnd, 35 ,{}, bDrawDebug, FColor::Orange, FColor::Green, 5);
+		FHitResult SliderDownPathTraceResult;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), SliderDownPathTraceStart, SliderDownPathTraceEnd, 35 , DetectionQueryParams, SliderDownPathTraceResult, bDrawDebug, FColor::Orange, FColor::Green, 5);
 		
 		FVector CharacterStandUpLocation;
 		if(SliderDownPathTraceResult.bBlockingHit)
@@ -135,12 +397,13 @@ void UClimbComponent::CrouchPressed()
 
 		FVector CharacterStandUpTraceStart = CharacterStandUpLocation + FVector::UpVector * (CharacterHalfHeight - CharacterRadius);
 		FVector CharacterStandUpTraceEnd = CharacterStandUpLocation - FVector::UpVector * (CharacterHalfHeight - CharacterRadius);
-		FHitResult CharacterStandUpTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, CharacterStandUpTraceStart, CharacterStandUpTraceEnd, 35, {}, bDrawDebug, FColor::Orange, FColor::Green, 5);
+		FHitResult CharacterStandUpTraceResult;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), CharacterStandUpTraceStart, CharacterStandUpTraceEnd, 35, DetectionQueryParams, CharacterStandUpTraceResult, bDrawDebug, FColor::Orange, FColor::Green, 5);
 
 		if(!CharacterStandUpTraceResult.bBlockingHit)
 			OwnerCharacter->Crouch();
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted BlendingOutDelegate;
 		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -148,13 +411,14 @@ void UClimbComponent::CrouchPressed()
 				OwnerCharacter->UnCrouch();
 			});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 }
 
 void UClimbComponent::CrouchReleased()
 {
-
+	if (bRecordingInput)
+		PendingCrouchFlags |= FClimbInputFrame::CrouchReleased;
 }
 
 void UClimbComponent::OnModeModeChangeEvent(ACharacter* Character, EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
@@ -162,6 +426,9 @@ void UClimbComponent::OnModeModeChangeEvent(ACharacter* Character, EMovementMode
 	if(!bComponentInitalize)
 		return;
 
+	//Entering walking snaps the capsule to the floor
+	RefreshFrameContext();
+
 	EMovementMode CurrentMoveMode = ClimbingMovementComponent->MovementMode;
 
 	if(CurrentMoveMode == MOVE_Walking &&
@@ -187,7 +454,7 @@ void UClimbComponent::OnModeModeChangeEvent(ACharacter* Character, EMovementMode
 		}
 			
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 	}
 }
 
@@ -196,11 +463,35 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	// ...
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_Tick);
+	FClimbTelemetryScope TelemetryScope(&Telemetry);
+
+	//Replayed crouches resize the capsule, apply them before the frame context is taken
+	if (IsReplayingInput())
+		ApplyReplayFrame();
+	else if (bRecordingInput)
+		RecordInputFrame(DeltaTime);
+
+	RefreshFrameContext();
+	bFrameContextValid = true;
+	ON_SCOPE_EXIT
+	{
+		bFrameContextValid = false;
+	};
+
+	if (ClimbState != StreamedClimbState)
+		UpdateMontageStreaming();
+
+	bool bRunDetection = ShouldRunDetection(DeltaTime);
+
 	switch (ClimbState)
 	{
 		case UClimbState::Default:
 		{
-			DefaultObstacleCheck(DeltaTime);
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickDefault);
+
+			if (bRunDetection)
+				DefaultObstacleCheck(DetectionDeltaTime);
 
 			HandleJumpInput(DeltaTime);	
 
@@ -213,7 +504,10 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::Climbing:
 		{
-			ObstacleCheckClimbing(DeltaTime);
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickClimbing);
+
+			if (bRunDetection)
+				ObstacleCheckClimbing(DetectionDeltaTime);
 
 			if(ClimbState != UClimbState::Climbing)
 				break;
@@ -225,7 +519,10 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::ClimbingPipe:
 		{
-			ObstacleCheckClimbPipe(DeltaTime);
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickClimbingPipe);
+
+			if (bRunDetection)
+				ObstacleCheckClimbPipe(DetectionDeltaTime);
 
 			if (ClimbState != UClimbState::ClimbingPipe)
 				break;
@@ -237,8 +534,11 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::Hanging:
 		{
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickHanging);
+
 			HangingRemapInputVector();
-			ObstacleCheckHanging(DeltaTime);
+			if (bRunDetection)
+				ObstacleCheckHanging(DetectionDeltaTime);
 			
 			if (ClimbState != UClimbState::Hanging)
 				break;
@@ -250,8 +550,11 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::Balance:
 		{
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickBalance);
+
 			BalanceRemapInputVector();
-			ObstacleCheckBalance(DeltaTime);
+			if (bRunDetection)
+				ObstacleCheckBalance(DetectionDeltaTime);
 
 			if (ClimbState != UClimbState::Balance)
 				break;
@@ -263,7 +566,10 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::NarrowSpace:
 		{
-			ObstacleCheckNarrowSpace(DeltaTime);
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickNarrowSpace);
+
+			if (bRunDetection)
+				ObstacleCheckNarrowSpace(DetectionDeltaTime);
 
 			if(ClimbState != UClimbState::NarrowSpace)
 				break;
@@ -276,8 +582,11 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 		case UClimbState::LedgeWalkLeft:
 		case UClimbState::LedgeWalkRight:
 		{
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickLedgeWalk);
+
 			bool IsRightWalk = (ClimbState == UClimbState::LedgeWalkRight);
-			ObstacleCheckLedgeWalk(DeltaTime, IsRightWalk);
+			if (bRunDetection)
+				ObstacleCheckLedgeWalk(DetectionDeltaTime, IsRightWalk);
 
 			if (ClimbState == UClimbState::LedgeWalkRight || ClimbState == UClimbState::LedgeWalkLeft)
 			{
@@ -289,6 +598,8 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 
 		case UClimbState::ZipLine:
 		{
+			CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_TickZipLine);
+
 			HandleZipLineInput();
 		}
 		break;
@@ -297,6 +608,12 @@ void UClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 		break;
 	}
 
+	UpdateAnimLedge();
+
+	IssueAsyncDetectionProbes(DeltaTime);
+
+	RecordTickTelemetry(DeltaTime);
+
 	MovementInput = FVector2D::ZeroVector;
 }
 
@@ -305,6 +622,64 @@ UClimbState UClimbComponent::GetClimbState()
 	return ClimbState;
 }
 
+void UClimbComponent::ResumeClimb(UClimbState State, const FVector& InObstacleLocation, const FVector& InObstacleNormalDir)
+{
+	if (!bComponentInitalize)
+		return;
+
+	if (State != UClimbState::Climbing && State != UClimbState::Hanging)
+		return;
+
+	ObstacleLocation = InObstacleLocation;
+	ObstacleNormalDir = InObstacleNormalDir;
+	ClimbingRotation = FRotator(0, (-InObstacleNormalDir).Rotation().Yaw, 0);
+
+	OwnerCharacter->SetActorRotation(ClimbingRotation);
+	RefreshFrameContext();
+
+	if (State == UClimbState::Climbing)
+		SetUpClimbingState();
+	else
+		SetUpHangingState();
+}
+
+bool UClimbComponent::CanHandOffToCrowd() const
+{
+	if (!bComponentInitalize || ClimbingAnimInstance->IsAnyMontagePlaying())
+		return false;
+
+	return ClimbState == UClimbState::Default && ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Walking;
+}
+
+void UClimbComponent::SetClimbIKTargets(FVector LeftHand, FVector RightHand, FVector LeftFoot, FVector RightFoot)
+{
+	if (ClimbCharacterAnimInstance == nullptr)
+		return;
+
+	FClimbAnimData& ClimbAnimData = ClimbCharacterAnimInstance->PendingClimbAnimData;
+	ClimbAnimData.LeftHandIKTarget = LeftHand;
+	ClimbAnimData.RightHandIKTarget = RightHand;
+	ClimbAnimData.LeftFootIKTarget = LeftFoot;
+	ClimbAnimData.RightFootIKTarget = RightFoot;
+}
+
+void UClimbComponent::GetCameraParameters(FTransform& OutPivotTarget, float& OutFOV, bool& OutRightShoulder) const
+{
+	const ACharacter* Character = CastChecked<ACharacter>(GetOwner());
+
+	OutPivotTarget = Character->GetActorTransform();
+
+	//Only the location follows the socket, bone rotation would shake the pivot offsets
+	const USkeletalMeshComponent* Mesh = Character->GetMesh();
+	if (CameraPivotSocket != NAME_None && Mesh != nullptr && Mesh->DoesSocketExist(CameraPivotSocket))
+	{
+		OutPivotTarget.SetLocation(Mesh->GetSocketLocation(CameraPivotSocket));
+	}
+
+	OutFOV = CameraFOV;
+	OutRightShoulder = bCameraRightShoulder;
+}
+
 void UClimbComponent::INT_FinishZiplineGliding_Implementation()
 {
 	ZipLineObj = nullptr;
@@ -316,7 +691,7 @@ void UClimbComponent::INT_FinishZiplineGliding_Implementation()
 	if (!FindMontagePlayInofoByClimbAction(UClimbAction::ZipLine_ZipLineGlidingToWalk, MontagePlayInofo))
 		return;
 
-	ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	PlayClimbMontage(MontagePlayInofo);
 }
 
 void UClimbComponent::HandleJumpInput(float DeltaTime)
@@ -373,6 +748,8 @@ void UClimbComponent::HandleDefaultMoveInput()
 
 void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckDefault);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -380,11 +757,10 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 		return;
 
 	FVector CurrentVelocity = ClimbingMovementComponent->Velocity;
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	float CharacterCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
 
 
 	if(UKismetMathLibrary::VSizeXY(CurrentVelocity) > 150 ||
@@ -418,33 +794,40 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 		bool HangingDectionResult = HangingObstacleDetectionDefault(100, 200, CurrentVelocity, DectionLocation, DectionNormal);
 		if(HangingDectionResult)
 		{
-			float TraceRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-			float TraceDistance = 2* (OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() - TraceRadius);
+			float TraceRadius = GetFrameContext().CapsuleRadius;
+			float TraceDistance = 2* (GetFrameContext().CapsuleHalfHeight - TraceRadius);
 			FVector HangingCheckStart = DectionLocation + FVector::DownVector * (30 + TraceRadius);
 			FVector HangingCheckEnd = HangingCheckStart + FVector::DownVector * TraceDistance;
 			
-			FHitResult HangingCheckHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, HangingCheckStart, HangingCheckEnd, TraceRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult HangingCheckHitResult;
+			UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), HangingCheckStart, HangingCheckEnd, TraceRadius, DetectionQueryParams, HangingCheckHitResult, bDrawDebug, FColor::Red, FColor::Green);
 
 			if(!HangingCheckHitResult.bBlockingHit)
 			{	
 				FVector FirstDectionHanglocation = DectionLocation;
 				FVector LastDectionHanglocation = DectionLocation;
 
-				for (size_t i = 1; i < 11; i++)
+				FClimbCachedFeature CachedLedge;
+				if (ClimbFeatureCache != nullptr && ClimbFeatureCache->FindFeature(EClimbFeatureType::Ledge, DectionLocation, DectionNormal, CachedLedge))
 				{
-					FVector TraceStart = FirstDectionHanglocation + DectionNormal * 10 + i * 2 * FVector::DownVector;
-					FVector TraceEnd = TraceStart + DectionNormal * - 10;
+					LastDectionHanglocation = DectionLocation + (CachedLedge.EndLocation - CachedLedge.Location);
+				}
+				else
+				{
+					UPrimitiveComponent* LedgePrimitive = nullptr;
 
-					FHitResult TraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd,{},bDrawDebug, FColor::Red, FColor::Green);
+					FVector TraceStart = FirstDectionHanglocation + DectionNormal * 10;
+					FVector TraceEnd = TraceStart + DectionNormal * - 10;
 
-					if(TraceResult.bBlockingHit)
+					FHitResult TraceResult;
+					if (UTraceBlueprintFunctionLibrary::FindEdgeExtent(GetWorld(), TraceStart, TraceEnd, FVector::DownVector, 20, 2, 1, DetectionQueryParams, TraceResult, bDrawDebug, FColor::Red, FColor::Green))
 					{
 						LastDectionHanglocation = TraceResult.ImpactPoint;
+						LedgePrimitive = TraceResult.GetComponent();
 					}
-					else
-					{
-						break;
-					}
+
+					if (ClimbFeatureCache != nullptr)
+						ClimbFeatureCache->AddFeature(EClimbFeatureType::Ledge, DectionLocation, DectionNormal, LastDectionHanglocation, LedgePrimitive);
 				}
 
 				FVector HangTargetLocation = (FirstDectionHanglocation + LastDectionHanglocation) / 2;
@@ -475,7 +858,7 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 
 				ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Flying);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+				PlayClimbMontage(MontagePlayInofo);
 
 				FOnMontageBlendingOutStarted BlendingOutDelegate;
 				BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -485,7 +868,7 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 						FindClimbingRotationIdle();
 					});
 
-				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 			}
 		}
 	}
@@ -497,20 +880,39 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 	{
 		ZipLineTraceIntervalTime = 0;
 		//ZipLine Trace
-		FVector ZipLineTraceStart = CharacterLocation + FVector::UpVector * CharacterCapsuleHalfHeight;
-		FVector ZipLineTraceEnd = CharacterLocation + FVector::UpVector * 2 * (CharacterCapsuleHalfHeight - CharacterRadius);
-
-		FHitResult ZipLineTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ZipLineTraceStart, ZipLineTraceEnd, CharacterRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 0, ECollisionChannel::ECC_GameTraceChannel1);
+		AActor* ZipLineObject = nullptr;
+		FVector ZipLineImpactPoint;
 
-		if (ZipLineTraceResult.bBlockingHit)
+		if (UsesZipLineIndex())
 		{
-			AActor* ZipLineObject = ZipLineTraceResult.GetActor();
+			FTraceRequest ZipLineTraceRequest = MakeZipLineDetectionRequest();
+			if (ZipLineSubsystem->FindZipLine(ZipLineTraceRequest.Start, ZipLineTraceRequest.End, ZipLineTraceRequest.Radius, ZipLineObject, ZipLineImpactPoint) && bDrawDebug)
+				DrawDebugSphere(GetWorld(), ZipLineImpactPoint, 5, 32, FColor::Green);
+		}
+		else
+		{
+			FHitResult ZipLineTraceResult;
+			if (!GetAsyncDetectionResult(EClimbAsyncProbe::ZipLine, ZipLineTraceResult))
+			{
+				FTraceRequest ZipLineTraceRequest = MakeZipLineDetectionRequest();
+				UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ZipLineTraceRequest.Start, ZipLineTraceRequest.End, ZipLineTraceRequest.Radius, DetectionQueryParams, ZipLineTraceResult, bDrawDebug, FColor::Red, FColor::Green, 0, ZipLineTraceRequest.CollisionChannel);
+			}
 
+			//The async result is a frame old, the zip line may have been destroyed since
+			if (ZipLineTraceResult.bBlockingHit && ZipLineTraceResult.GetActor() != nullptr)
+			{
+				ZipLineObject = ZipLineTraceResult.GetActor();
+				ZipLineImpactPoint = ZipLineTraceResult.ImpactPoint;
+			}
+		}
+
+		if (ZipLineObject != nullptr)
+		{
 			UClass* ZipLineClass = ZipLineObject->GetClass();
 			if (ZipLineClass->ImplementsInterface(UIZipSystem::StaticClass()))
 			{
 				FZipLineData ZipLineData;
-				IIZipSystem::Execute_INT_GetZipLineData(ZipLineObject, ZipLineTraceResult.ImpactPoint, ZipLineData);
+				IIZipSystem::Execute_INT_GetZipLineData(ZipLineObject, ZipLineImpactPoint, ZipLineData);
 
 				FVector HookUpVector = CharacterUpVector;
 				FVector HookRightVector = FVector::CrossProduct(HookUpVector, ZipLineData.ZipLineEndLocation - ZipLineData.ZipLineStartLocation).GetSafeNormal();;
@@ -520,7 +922,7 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 
 				if(AngleV1ToV2 <= 45)
 				{
-					FVector ActorToHitLocationNormal = (ZipLineTraceResult.ImpactPoint - CharacterLocation).GetSafeNormal();
+					FVector ActorToHitLocationNormal = (ZipLineImpactPoint - CharacterLocation).GetSafeNormal();
 					bool AtZipRight = (FVector::DotProduct( HookRightVector, ActorToHitLocationNormal) >= 0);
 
 					FMontagePlayInofo MontagePlayInofo;
@@ -550,7 +952,7 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 
 					SetUpZipLineState(true);
 
-					ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+					PlayClimbMontage(MontagePlayInofo);
 
 					FOnMontageBlendingOutStarted BlendingOutDelegate;
 					BlendingOutDelegate.BindLambda([this, ZipLineGlidingZOffset, ZipLineData, ZipLineObject](UAnimMontage* Montage, bool bInterrupted)
@@ -560,7 +962,7 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 							IIZipSystem::Execute_INT_StartZiplineGliding(ZipLineObject);
 						});
 
-					ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+					ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 				}
 			}
 		}
@@ -569,6 +971,8 @@ void UClimbComponent::ObstacleCheckDefault(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckDefaultByInput()
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckDefaultByInput);
+
 	if (!bComponentInitalize)
 		return;
 
@@ -578,14 +982,14 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 	if(ClimbState != UClimbState::Default)
 		return;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FRotator CharacterRotation = OwnerCharacter->GetActorRotation();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FRotator CharacterRotation = GetFrameContext().Rotation;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 	FVector CharacterFootLocation = GetFootLocation();
 
-	float CharacterCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float CharacterCapsuleRadius = GetFrameContext().CapsuleRadius;
 
 	bool ObstacleCheckResult = false;
 
@@ -598,10 +1002,11 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 	FVector SlopeTraceStart = CharacterLocation + CharacterUpVector* CharacterCapsuleHalfHeight* -0.50 + CharacterForwardVector * CharacterCapsuleRadius;
 	FVector SlopeTraceEnd = SlopeTraceStart + CharacterUpVector * SlopeTrace + CharacterForwardVector * SlopeTrace;
 
-	FHitResult SlopeTraceHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, SlopeTraceStart, SlopeTraceEnd, 10,TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green,5);
+	FHitResult SlopeTraceHitResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), SlopeTraceStart, SlopeTraceEnd, 10, DetectionQueryParams, SlopeTraceHitResult, bDrawDebug, FColor::Red, FColor::Green,5);
 
 	//Pipe detection
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector CharacterRightLocation = CharacterLocation + CharacterRightVector * CharacterCapsuleRadius;
 	FVector CharacterLeftLocation = CharacterLocation + CharacterRightVector * CharacterCapsuleRadius * -1;
 
@@ -613,8 +1018,17 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 		FVector PipeRightTraceStart = FVector(CharacterRightLocation.X, CharacterRightLocation.Y, SlopeTraceHitResult.ImpactPoint.Z);
 		FVector PipeRightTraceEnd = PipeRightTraceStart + CharacterForwardVector * SlopeTrace * 4;
 
-		FHitResult PipeLeftTraceHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeLeftTraceStart, PipeLeftTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
-		FHitResult PipeRightTraceHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeRightTraceStart, PipeRightTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
+		FTraceRequest PipeTraceRequests[2];
+		PipeTraceRequests[0].Start = PipeLeftTraceStart;
+		PipeTraceRequests[0].End = PipeLeftTraceEnd;
+		PipeTraceRequests[1].Start = PipeRightTraceStart;
+		PipeTraceRequests[1].End = PipeRightTraceEnd;
+
+		FTraceHitRecord PipeTraceHitRecords[2];
+		UTraceBlueprintFunctionLibrary::BatchTrace(GetWorld(), PipeTraceRequests, DetectionQueryParams, PipeTraceHitRecords, bDrawDebug, FColor::Red, FColor::Green, 5);
+
+		const FTraceHitRecord& PipeLeftTraceHitResult = PipeTraceHitRecords[0];
+		const FTraceHitRecord& PipeRightTraceHitResult = PipeTraceHitRecords[1];
 
 		bool IsPipe = false;
 
@@ -651,7 +1065,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 					UKismetMathLibrary::MakeRotFromX(-ObstacleDetectionNormal) :
 					FRotator(CharacterRotation.Pitch, CharacterRotation.Yaw, 0);
 
-				FHitResult ObstacleHitResult = UTraceBlueprintFunctionLibrary::BoxTrace(OwnerCharacter, ObstacleTraceStart, ObstacleTraceEnd, BoxRotation, CheckBoxHalfSize, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
+				FHitResult ObstacleHitResult;
+				UTraceBlueprintFunctionLibrary::BoxTrace(GetWorld(), ObstacleTraceStart, ObstacleTraceEnd, BoxRotation, CheckBoxHalfSize, DetectionQueryParams, ObstacleHitResult, bDrawDebug, FColor::Red, FColor::Green, 5);
 
 				if (ObstacleHitResult.bBlockingHit)
 				{
@@ -682,7 +1097,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 						FVector ObstacleClimbTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius + 25) + FVector::UpVector * CharacterCapsuleHalfHeight;
 						FVector ObstacleClimbTraceEnd = ObstacleClimbTraceStart + FVector::DownVector * (ObstacleDetectionLocation.Z - CharacterLocation.Z);
 
-						FHitResult ObstacleClimbHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ObstacleClimbTraceStart, ObstacleClimbTraceEnd, CharacterCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Green, FColor::Red, 5);
+						FHitResult ObstacleClimbHitResult;
+						UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ObstacleClimbTraceStart, ObstacleClimbTraceEnd, CharacterCapsuleRadius, DetectionQueryParams, ObstacleClimbHitResult, bDrawDebug, FColor::Green, FColor::Red, 5);
 
 						if (ObstacleClimbHitResult.bBlockingHit)
 						{
@@ -693,7 +1109,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 						FVector ObstacleWallCheckTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius + 50) * -1 + FVector::UpVector * CharacterCapsuleHalfHeight;
 						FVector ObstacleWallCheckTraceEnd = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius + 50) * -1 + FVector::DownVector * CharacterCapsuleHalfHeight * 0.5;
 
-						FHitResult ObstacleWallCheckHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ObstacleWallCheckTraceStart, ObstacleWallCheckTraceEnd, CharacterCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Orange, FColor::Green, 5);
+						FHitResult ObstacleWallCheckHitResult;
+						UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ObstacleWallCheckTraceStart, ObstacleWallCheckTraceEnd, CharacterCapsuleRadius, DetectionQueryParams, ObstacleWallCheckHitResult, bDrawDebug, FColor::Orange, FColor::Green, 5);
 
 						bool ObstacleIsWall = !ObstacleWallCheckHitResult.bBlockingHit;
 
@@ -703,7 +1120,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 							FVector CharacterCanStandTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius) * -1 + FVector::UpVector * (CharacterCapsuleHalfHeight * 2);
 							FVector CharacterCanStandTraceEnd = CharacterCanStandTraceStart + FVector::DownVector * (CharacterCapsuleHalfHeight * 2 - CharacterCapsuleRadius - 15);;
 
-							FHitResult CharacterCanStandHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, CharacterCanStandTraceStart, CharacterCanStandTraceEnd, CharacterCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Green, FColor::Red, 5);
+							FHitResult CharacterCanStandHitResult;
+							UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), CharacterCanStandTraceStart, CharacterCanStandTraceEnd, CharacterCapsuleRadius, DetectionQueryParams, CharacterCanStandHitResult, bDrawDebug, FColor::Green, FColor::Red, 5);
 
 							if (!CharacterCanStandHitResult.bBlockingHit)
 							{
@@ -737,7 +1155,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 
 									ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Flying);
 
-									ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+									PlayClimbMontage(MontagePlayInofo);
 
 									FOnMontageBlendingOutStarted BlendingOutDelegate;
 									BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -745,7 +1163,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 											ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Walking);
 										});
 
-									ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+									ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
 									break;
 								}
@@ -760,7 +1178,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 								FVector CharacterCanVaultTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius) * -1 + FVector::UpVector * (CharacterCapsuleHalfHeight);
 								FVector CharacterCanVaultTraceEnd = CharacterCanVaultTraceStart + FVector::DownVector * (CharacterCapsuleHalfHeight - CharacterCapsuleRadius - 15);
 
-								FHitResult CharacterCanPassHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, CharacterCanVaultTraceStart, CharacterCanVaultTraceEnd, CharacterCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Green, FColor::Red, 5);
+								FHitResult CharacterCanPassHitResult;
+								UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), CharacterCanVaultTraceStart, CharacterCanVaultTraceEnd, CharacterCapsuleRadius, DetectionQueryParams, CharacterCanPassHitResult, bDrawDebug, FColor::Green, FColor::Red, 5);
 
 								if (!CharacterCanPassHitResult.bBlockingHit)
 								{
@@ -768,7 +1187,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 									FVector CharacterVaultPointFloorTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius + 50) * -1;
 									FVector CharacterVaultPointFloorTraceEnd = CharacterVaultPointFloorTraceStart + FVector::DownVector * (ObstacleDetectionHight + CharacterCapsuleHalfHeight * 2);
 
-									FHitResult CharacterVaultPointFloorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterVaultPointFloorTraceStart, CharacterVaultPointFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Red, 5);
+									FHitResult CharacterVaultPointFloorHitResult;
+									UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterVaultPointFloorTraceStart, CharacterVaultPointFloorTraceEnd, DetectionQueryParams, CharacterVaultPointFloorHitResult, bDrawDebug, FColor::Yellow, FColor::Red, 5);
 
 									bool CanVault = CharacterVaultPointFloorHitResult.bBlockingHit || CharacterVaultPointFloorHitResult.Distance >= 150;
 									bool UseHighAnim = (ObstacleDetectionHight >= 150);
@@ -817,7 +1237,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 										FVector CharacterVaultEndPointTraceStart = ObstacleDetectionLocation + ObstacleDetectionNormal * (CharacterCapsuleRadius) * -1 + FVector::DownVector * (CharacterCapsuleHalfHeight + CharacterCapsuleRadius);
 										FVector CharacterVaultEndPointTraceEnd = CharacterVaultEndPointTraceStart + ObstacleDetectionNormal * (CharacterCapsuleRadius + 10);
 
-										FHitResult  CharacterVaultEndPointHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterVaultEndPointTraceStart, CharacterVaultEndPointTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Red, 5);
+										FHitResult CharacterVaultEndPointHitResult;
+										UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterVaultEndPointTraceStart, CharacterVaultEndPointTraceEnd, DetectionQueryParams, CharacterVaultEndPointHitResult, bDrawDebug, FColor::Yellow, FColor::Red, 5);
 
 										FTransform MotionWarpingEndTransform;
 										FRotator MotionWarpingEndRotation = UKismetMathLibrary::MakeRotFromX(-CharacterVaultEndPointHitResult.Normal);
@@ -839,7 +1260,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 
 									ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Flying);
 
-									ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+									PlayClimbMontage(MontagePlayInofo);
 
 									if (CanVault)
 									{
@@ -849,7 +1270,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 												ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Walking);
 											});
 
-										ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+										ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 									}
 									else
 									{
@@ -860,7 +1281,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 												FindClimbingRotationIdle();
 											});
 
-										ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+										ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 									}
 									break;
 								}
@@ -878,7 +1299,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 			FVector PipeTraceEnd = FVector(PipeLocation.X, PipeLocation.Y, SlopeTraceHitResult.ImpactPoint.Z);
 			FVector PipeTraceStart = PipeTraceEnd + TraceDirection * 50;
 
-			FHitResult PipeTraceHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeTraceStart, PipeTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
+			FHitResult PipeTraceHitResult;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeTraceStart, PipeTraceEnd, DetectionQueryParams, PipeTraceHitResult, bDrawDebug, FColor::Red, FColor::Green, 5);
 
 			if (!PipeTraceHitResult.bBlockingHit)
 				return;
@@ -911,7 +1333,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 
 			SetUpClimbingPipeState();
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 
 			FOnMontageBlendingOutStarted BlendingOutDelegate;
 			BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -920,7 +1342,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 					FindClimbingRotationIdle();
 				});
 
-			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 		}
 	}
 	else
@@ -928,7 +1350,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 		FVector ZipLineTraceStart = CharacterLocation;
 		FVector ZipLineTraceEnd = CharacterLocation + CharacterUpVector * ( CharacterCapsuleHalfHeight * 2 - CharacterCapsuleRadius );
 
-		FHitResult ZipLineTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ZipLineTraceStart, ZipLineTraceEnd, CharacterCapsuleRadius,{OwnerCharacter}, bDrawDebug, FColor::Red, FColor::Green,3,ECollisionChannel::ECC_GameTraceChannel1);
+		FHitResult ZipLineTraceResult;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ZipLineTraceStart, ZipLineTraceEnd, CharacterCapsuleRadius, DetectionIgnoreOwnerQueryParams, ZipLineTraceResult, bDrawDebug, FColor::Red, FColor::Green,3,ECollisionChannel::ECC_GameTraceChannel1);
 
 		if(ZipLineTraceResult.bBlockingHit)
 		{
@@ -953,7 +1376,8 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 				FVector ZipLineHookTraceEnd = ZipLineHookTraceStart +
 											  HookUpVector * CharacterCapsuleHalfHeight;
 
-				FHitResult ZipLineHookTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ZipLineHookTraceStart, ZipLineHookTraceEnd, CharacterCapsuleRadius, { OwnerCharacter }, bDrawDebug, FColor::Red, FColor::Green, 3, ECollisionChannel::ECC_GameTraceChannel1);
+				FHitResult ZipLineHookTraceResult;
+				UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ZipLineHookTraceStart, ZipLineHookTraceEnd, CharacterCapsuleRadius, DetectionIgnoreOwnerQueryParams, ZipLineHookTraceResult, bDrawDebug, FColor::Red, FColor::Green, 3, ECollisionChannel::ECC_GameTraceChannel1);
 
 				IIZipSystem::Execute_INT_GetZipLineData(ZipLineObject, ZipLineHookTraceResult.ImpactPoint, ZipLineData);
 
@@ -982,7 +1406,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 
 				ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Flying);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+				PlayClimbMontage(MontagePlayInofo);
 
 				FOnMontageBlendingOutStarted BlendingOutDelegate;
 				BlendingOutDelegate.BindLambda([this, ZipLineGlidingZOffset, ZipLineData, ZipLineObject](UAnimMontage* Montage, bool bInterrupted)
@@ -992,7 +1416,7 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 						IIZipSystem::Execute_INT_StartZiplineGliding(ZipLineObject);
 					});
 
-				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
 			}
 		}
@@ -1001,12 +1425,13 @@ void UClimbComponent::ObstacleCheckDefaultByInput()
 
 bool UClimbComponent::ObstacleDetectionDefault(float MinDistance, float MaxDistance, const FVector& Velocity, FVector& Location, FVector& Normal)
 {
-	float Distance = FMath::GetMappedRangeValueClamped(FVector2f(0, MaxDistance / 5), FVector2f(MinDistance, MaxDistance), Velocity.Length());
-
-	FVector TraceStart = OwnerCharacter->GetActorLocation();
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TraceStart;
+	FHitResult HitResult;
+	if (!GetAsyncDetectionResult(EClimbAsyncProbe::Obstacle, HitResult))
+	{
+		FTraceRequest TraceRequest = MakeObstacleDetectionDefaultRequest(MinDistance, MaxDistance, Velocity);
+		UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceRequest.Start, TraceRequest.End, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
+	}
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
 	if(HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -1018,16 +1443,30 @@ bool UClimbComponent::ObstacleDetectionDefault(float MinDistance, float MaxDista
 
 bool UClimbComponent::HangingObstacleDetectionDefault(float MinDistance, float MaxDistance, const FVector& Velocity, FVector& Location, FVector& Normal)
 {
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float Distance = FMath::GetMappedRangeValueClamped(FVector2f(0, MaxDistance / 5), FVector2f(MinDistance, MaxDistance), Velocity.Size2D());
-	float Height = FMath::GetMappedRangeValueClamped(FVector2f(-5 * CharacterHalfHeight, 5 * CharacterHalfHeight), FVector2f(-(CharacterHalfHeight - 10), (CharacterHalfHeight - 10)), Velocity.Z);
+	//Baked ledges skip the trace, anything the bake could not see (movable or spawned geometry, complex collision) is still traced
+	if (bUseClimbFeatureIndex && ClimbFeatureIndex != nullptr)
+	{
+		FTraceRequest TraceRequest = MakeHangingObstacleDetectionDefaultRequest(MinDistance, MaxDistance, Velocity);
 
-	//FVector TraceStart = GetFootLocation() + FVector::UpVector * 10;
-	FVector TraceStart = OwnerCharacter->GetActorLocation() + FVector::UpVector * Height;
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TraceStart;
+		FVector FeatureLocation;
+		FVector FeatureNormal;
+		if (ClimbFeatureIndex->SweepFeatureFaces(EClimbFeatureType::Ledge, TraceRequest.Start, TraceRequest.End, TraceRequest.Radius, FeatureLocation, FeatureNormal))
+		{
+			Location = FeatureLocation;
+			Normal = FVector(FeatureNormal.X, FeatureNormal.Y, 0).GetSafeNormal();
+
+			return true;
+		}
+	}
+
+	FHitResult HitResult;
+	if (!GetAsyncDetectionResult(EClimbAsyncProbe::HangingObstacle, HitResult))
+	{
+		FTraceRequest TraceRequest = MakeHangingObstacleDetectionDefaultRequest(MinDistance, MaxDistance, Velocity);
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), TraceRequest.Start, TraceRequest.End, TraceRequest.Radius, DetectionIgnoreOwnerQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
+		//FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, { OwnerCharacter }, bDrawDebug, FColor::Red, FColor::Green);
+	}
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, TraceStart, TraceEnd, 5,{OwnerCharacter}, bDrawDebug, FColor::Red, FColor::Green);
-	//FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, { OwnerCharacter }, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -1040,6 +1479,8 @@ bool UClimbComponent::HangingObstacleDetectionDefault(float MinDistance, float M
 
 void UClimbComponent::ObstacleCheckClimbing(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckClimbing);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1076,6 +1517,8 @@ void UClimbComponent::ObstacleCheckClimbing(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckClimbPipe(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckClimbPipe);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1112,6 +1555,8 @@ void UClimbComponent::ObstacleCheckClimbPipe(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckHanging(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckHanging);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1148,6 +1593,8 @@ void UClimbComponent::ObstacleCheckHanging(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckBalance(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckBalance);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1183,6 +1630,8 @@ void UClimbComponent::ObstacleCheckBalance(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckNarrowSpace(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckNarrowSpace);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1218,6 +1667,8 @@ void UClimbComponent::ObstacleCheckNarrowSpace(float DeltaTime)
 
 void UClimbComponent::ObstacleCheckLedgeWalk(float DeltaTime, bool IsRightWalk)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ObstacleCheckLedgeWalk);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -1247,10 +1698,11 @@ void UClimbComponent::ObstacleCheckLedgeWalk(float DeltaTime, bool IsRightWalk)
 
 bool UClimbComponent::ObstacleDetectionClimbing(float Distance, FVector& Location, FVector& Normal)
 {
-	FVector TreceStart = OwnerCharacter->GetActorLocation();
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TreceStart;
+	FVector TreceStart = GetFrameContext().Location;
+	FVector TraceEnd = GetFrameContext().ForwardVector * Distance + TreceStart;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TreceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Yellow,FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TreceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Yellow,FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -1267,11 +1719,12 @@ bool UClimbComponent::ObstacleDetectionClimbing(float Distance, FVector& Locatio
 
 bool UClimbComponent::ObstacleDetectionHanging(float Distance, FVector& Location, FVector& Normal)
 {
-	FVector TreceStart = GetTopLocation() + FVector::UpVector * GHangingTraceOffsetZ + OwnerCharacter->GetActorForwardVector() * -10;
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TreceStart;
+	FVector TreceStart = GetTopLocation() + FVector::UpVector * GHangingTraceOffsetZ + GetFrameContext().ForwardVector * -10;
+	FVector TraceEnd = GetFrameContext().ForwardVector * Distance + TreceStart;
 
 	//FHitResult HitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, TreceStart, TraceEnd, 5,TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TreceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TreceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -1291,7 +1744,8 @@ bool UClimbComponent::FloorDectectionBalance(FVector& Location, FVector& Normal)
 	FVector TraceStart = GetFootLocation() + FVector::UpVector * 20;
 	FVector TraceEnd = TraceStart + FVector::DownVector * 30;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, TraceStart, TraceEnd, 10,TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), TraceStart, TraceEnd, 10, DetectionQueryParams, HitResult, bDrawDebug, FColor::Yellow, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -1308,13 +1762,14 @@ bool UClimbComponent::FloorDectectionBalance(FVector& Location, FVector& Normal)
 
 bool UClimbComponent::ObstacleDetectionNarrowSpace(FVector& Location, FVector& Normal)
 {
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 
-	FVector TraceStart = OwnerCharacter->GetActorLocation();
+	FVector TraceStart = GetFrameContext().Location;
 	FVector TraceEnd = TraceStart + CharacterRightVector * CharacterRadius;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -1331,14 +1786,15 @@ bool UClimbComponent::ObstacleDetectionNarrowSpace(FVector& Location, FVector& N
 
 bool UClimbComponent::ObstacleDetectionLedgeWalk(bool IsRightWalk, FVector& Location, FVector& Normal)
 {
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 
-	FVector TraceStart = OwnerCharacter->GetActorLocation();
+	FVector TraceStart = GetFrameContext().Location;
 	FVector TraceEnd = TraceStart + TraceVector * CharacterRadius;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -1903,228 +2359,127 @@ bool UClimbComponent::LedgeWalkDownCheck(float DeltaTime, bool IsRightWalk)
 
 bool UClimbComponent::ClimbRightJumpCheck()
 {
-	bool CanRightJump = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanRightJump;
-	
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbRightJumpCheck);
 
-	TArray<FVector2D> TraceDataArray;
-	TraceDataArray.Add(FVector2D(200, 150));
-	TraceDataArray.Add(FVector2D(350, 150));
-
-	TArray<UClimbAction> ClimbActionList = {
-	UClimbAction::ClimbingAction_RightJump,
-	UClimbAction::ClimbingAction_SuperRightJump
-	};
-
-	for (int i = 0; i < TraceDataArray.Num(); i++)
-	{
-		FVector2D& TraceData = TraceDataArray[i];
-
-		FVector RightJumpTraceStart = CharacterLocation + CharacterRightVector * TraceData.X;
-		FVector RightJumpTraceEnd = RightJumpTraceStart + CharacterForwardVector * TraceData.Y;
-
-		FHitResult RightJumpHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, RightJumpTraceStart, RightJumpTraceEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green, 3);
-
-		float RightJumpAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(RightJumpHit.ImpactNormal.GetSafeNormal(), -CharacterForwardVector));
+	return ClimbSideJumpCheck(false);
+}
 
-		if (RightJumpHit.bBlockingHit &&
-			RightJumpAngle <= 5)
-		{
-			FVector RightJumpPlayerTraceStart = CharacterLocation;
-			FVector RightJumpPlayerTraceEnd = RightJumpTraceStart;
+bool UClimbComponent::ClimbLeftJumpCheck()
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbLeftJumpCheck);
 
-			FHitResult RightJumpPlayerHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, RightJumpPlayerTraceStart, RightJumpPlayerTraceEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Green, 3);
+	return ClimbSideJumpCheck(true);
+}
 
-			if (!RightJumpPlayerHit.bBlockingHit)
-			{
-				FMontagePlayInofo MontagePlayInofo;
+bool UClimbComponent::ClimbSideJumpCheck(bool bLeft)
+{
+	if (ClimbingAnimInstance->IsAnyMontagePlaying())
+		return false;
 
-				if (!FindMontagePlayInofoByClimbAction(ClimbActionList[i], MontagePlayInofo))
-				{
-					continue;
-				}
+	FClimbProbeResult ProbeResult;
+	if (!EvaluateProbes(EClimbProbeGroup::ClimbSideJump, bLeft, ProbeResult))
+		return false;
 
-				FTransform MotionWarpingTransform;
+	const FMontagePlayInofo& MontagePlayInofo = ProbeResult.MontagePlayInofo;
 
-				FRotator MotionWarpingRotation;
-				MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+	FTransform MotionWarpingTransform;
 
-				MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
+	FRotator MotionWarpingRotation;
+	MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
-				FVector MotionWarpingLocation = RightJumpHit.ImpactPoint + 
-												CharacterRightVector * MontagePlayInofo.AnimMontageOffSet.X +
-												RightJumpHit.ImpactNormal * MontagePlayInofo.AnimMontageOffSet.Y;
+	MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
-				MotionWarpingTransform.SetLocation(MotionWarpingLocation);
+	FVector MotionWarpingLocation = ProbeResult.Hit.ImpactPoint + 
+									GetFrameContext().RightVector * MontagePlayInofo.AnimMontageOffSet.X +
+									ProbeResult.Hit.ImpactNormal * MontagePlayInofo.AnimMontageOffSet.Y;
 
-				if (bDrawDebug)
-					DrawDebugSphere(OwnerCharacter->GetWorld(), MotionWarpingLocation, 10, 32, FColor::Yellow, false, 3);
+	MotionWarpingTransform.SetLocation(MotionWarpingLocation);
 
-				FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
-				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
+	if (bDrawDebug)
+		DrawDebugSphere(OwnerCharacter->GetWorld(), MotionWarpingLocation, 10, 32, FColor::Yellow, false, 3);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
+	MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-				CanRightJump = true;
-				break;
-			}
-		}
-	}
+	PlayClimbMontage(MontagePlayInofo);
 
-	return CanRightJump;
+	return true;
 }
 
-bool UClimbComponent::ClimbLeftJumpCheck()
+bool UClimbComponent::ClimbDownJumpCheck()
 {
-	bool CanLeftJump = false;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbDownJumpCheck);
+
+	bool FindClimbDownJump = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanLeftJump;
+		return FindClimbDownJump;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 
-	TArray<FVector2D> TraceDataArray;
-	TraceDataArray.Add(FVector2D(-200, 150));
-	TraceDataArray.Add(FVector2D(-350, 150));
+	FVector ClimbDownJumpTraceStart = GetFootLocation() + CharacterUpVector * -250;
+	FVector ClimbDownJumpTraceEnd = ClimbDownJumpTraceStart + CharacterForwardVector * 150;
 
-	TArray<UClimbAction> ClimbActionList = {
-		UClimbAction::ClimbingAction_LeftJump,
-		UClimbAction::ClimbingAction_SuperLeftJump
-	};
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), ClimbDownJumpTraceStart, ClimbDownJumpTraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green, 3);
 
-	for (int i = 0; i < TraceDataArray.Num(); i++)
+	if(HitResult.bBlockingHit)
 	{
-		FVector2D& TraceData = TraceDataArray[i];
+		FMontagePlayInofo MontagePlayInofo;
 
-		FVector LeftJumpTraceStart = CharacterLocation + CharacterRightVector * TraceData.X;
-		FVector LeftJumpTraceEnd = LeftJumpTraceStart + CharacterForwardVector * TraceData.Y;
+		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_JumpDown, MontagePlayInofo))
+			return false;
 
-		FHitResult LeftJumpHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, LeftJumpTraceStart, LeftJumpTraceEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green, 3);
+		FindClimbDownJump = true;
+		
+		FTransform MotionWarpingTransform;
 
-		float LeftJumpAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(LeftJumpHit.ImpactNormal.GetSafeNormal(), -CharacterForwardVector));
+		FRotator MotionWarpingRotation;
+		MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
-		if (LeftJumpHit.bBlockingHit &&
-			LeftJumpAngle <= 5)
-		{
-			FVector LeftJumpPlayerTraceStart = CharacterLocation;
-			FVector LeftJumpPlayerTraceEnd = LeftJumpTraceStart;
+		MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
-			FHitResult LeftJumpPlayerHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, LeftJumpPlayerTraceStart, LeftJumpPlayerTraceEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Green, 3);
+		FVector MotionWarpingLocation = HitResult.ImpactPoint + 
+										ObstacleNormalDir * MontagePlayInofo.AnimMontageOffSet.X +
+										CharacterUpVector * MontagePlayInofo.AnimMontageOffSet.Y;
+		
 
-			if (!LeftJumpPlayerHit.bBlockingHit)
-			{
-				FMontagePlayInofo MontagePlayInofo;// = MontagePlayInfoArray[i];
+		MotionWarpingTransform.SetLocation(MotionWarpingLocation);
 
-				if(!FindMontagePlayInofoByClimbAction(ClimbActionList[i], MontagePlayInofo))
-				{
-					continue;
-				}
+		if (bDrawDebug)
+			DrawDebugSphere(OwnerCharacter->GetWorld(), MotionWarpingLocation, 10, 32, FColor::Yellow, false, 3);
 
-				FTransform MotionWarpingTransform;
+		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
+		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-				FRotator MotionWarpingRotation;
-				MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
-
-				MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
-
-				FVector MotionWarpingLocation = LeftJumpHit.ImpactPoint +
-												CharacterRightVector * MontagePlayInofo.AnimMontageOffSet.X +
-												LeftJumpHit.ImpactNormal * MontagePlayInofo.AnimMontageOffSet.Y;
-
-
-				MotionWarpingTransform.SetLocation(MotionWarpingLocation);
-
-				if (bDrawDebug)
-					DrawDebugSphere(OwnerCharacter->GetWorld(), MotionWarpingLocation, 10, 32, FColor::Yellow, false, 3);
-
-				FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
-				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
-
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-
-				CanLeftJump = true;
-				break;
-			}
-		}
-	}
-
-	return CanLeftJump;
-}
-
-bool UClimbComponent::ClimbDownJumpCheck()
-{
-	bool FindClimbDownJump = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return FindClimbDownJump;
-
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-
-	FVector ClimbDownJumpTraceStart = GetFootLocation() + CharacterUpVector * -250;
-	FVector ClimbDownJumpTraceEnd = ClimbDownJumpTraceStart + CharacterForwardVector * 150;
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, ClimbDownJumpTraceStart, ClimbDownJumpTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
-
-	if(HitResult.bBlockingHit)
-	{
-		FMontagePlayInofo MontagePlayInofo;
-
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_JumpDown, MontagePlayInofo))
-			return false;
-
-		FindClimbDownJump = true;
-		
-		FTransform MotionWarpingTransform;
-
-		FRotator MotionWarpingRotation;
-		MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
-
-		MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
-
-		FVector MotionWarpingLocation = HitResult.ImpactPoint + 
-										ObstacleNormalDir * MontagePlayInofo.AnimMontageOffSet.X +
-										CharacterUpVector * MontagePlayInofo.AnimMontageOffSet.Y;
-		
-
-		MotionWarpingTransform.SetLocation(MotionWarpingLocation);
-
-		if (bDrawDebug)
-			DrawDebugSphere(OwnerCharacter->GetWorld(), MotionWarpingLocation, 10, 32, FColor::Yellow, false, 3);
-
-		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
-		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
-
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-	}
+		PlayClimbMontage(MontagePlayInofo);
+	}
 
 	return FindClimbDownJump;
 }
 
 bool UClimbComponent::ClimbUpJumpCheck()
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbUpJumpCheck);
+
 	bool FindClimbUpJump = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindClimbUpJump;
 
-	FVector JumpUpCheckStart = GetTopLocation() + OwnerCharacter->GetActorUpVector() * 220;
-	FVector JumpUpCheckEnd = JumpUpCheckStart + OwnerCharacter->GetActorForwardVector() * 150;
+	FVector JumpUpCheckStart = GetTopLocation() + GetFrameContext().UpVector * 220;
+	FVector JumpUpCheckEnd = JumpUpCheckStart + GetFrameContext().ForwardVector * 150;
 
-	FHitResult JumpUpCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, JumpUpCheckStart, JumpUpCheckEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green, 3);
+	FHitResult JumpUpCheckHit;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), JumpUpCheckStart, JumpUpCheckEnd, 10, DetectionQueryParams, JumpUpCheckHit, bDrawDebug, FColor::Blue, FColor::Green, 3);
 
 	FVector JumpUpPlayerCheckStart = GetTopLocation();
 	FVector JumpUpPlayerCheckEnd = JumpUpCheckStart;
 
-	FHitResult JumpUpPlayerCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, JumpUpPlayerCheckStart, JumpUpPlayerCheckEnd, 10, TArray<AActor*>(), bDrawDebug, FColor::Cyan, FColor::Green, 3);
+	FHitResult JumpUpPlayerCheckHit;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), JumpUpPlayerCheckStart, JumpUpPlayerCheckEnd, 10, DetectionQueryParams, JumpUpPlayerCheckHit, bDrawDebug, FColor::Cyan, FColor::Green, 3);
 
 
 	if (JumpUpCheckHit.bBlockingHit &&
@@ -2140,15 +2495,15 @@ bool UClimbComponent::ClimbUpJumpCheck()
 		FTransform MotionWarpingTransform;
 
 		FRotator MotionWarpingRotation;
-		MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+		MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 		MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
 		FVector MotionWarpingLocation = JumpUpCheckHit.ImpactPoint + ObstacleNormalDir * MontagePlayInofo.AnimMontageOffSet.X;
 		MotionWarpingLocation.Z = MotionWarpingLocation.Z -
 								  MontagePlayInofo.AnimMontageOffSet.Y - 
-								  OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() - 
-								  OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+								  GetFrameContext().CapsuleHalfHeight - 
+								  GetFrameContext().CapsuleRadius;
 
 		MotionWarpingTransform.SetLocation(MotionWarpingLocation);
 
@@ -2158,7 +2513,7 @@ bool UClimbComponent::ClimbUpJumpCheck()
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 	}
 
 	return FindClimbUpJump;
@@ -2166,378 +2521,210 @@ bool UClimbComponent::ClimbUpJumpCheck()
 
 bool UClimbComponent::ClimbRightCornerInnerCheck()
 {
-	bool CanRightCornerInner = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanRightCornerInner;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbRightCornerInnerCheck);
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-
-	FVector RightCornerInnerTraceEnd = CharacterLocation + CharacterForwardVector * 85;
-	FVector RightCornerInnerTraceStart = RightCornerInnerTraceEnd + CharacterRightVector * 85;
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, RightCornerInnerTraceStart, RightCornerInnerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green,3);
-
-	float CornerInnerAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), CharacterRightVector));
-	if(HitResult.bBlockingHit &&
-		CornerInnerAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
-
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_InnerRight, MontagePlayInofo))
-			return false;
-
-		CanRightCornerInner = true;
-		
-		FVector AdjustLocation = HitResult.ImpactPoint +
-								 CharacterRightVector * -55 -
-								 CharacterForwardVector * (50 + OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius());
-
-		OwnerCharacter->SetActorLocation(AdjustLocation,true);
-
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
-
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
-
-	return CanRightCornerInner;
+	return ClimbCornerInnerCheck(false);
 }
 
 bool UClimbComponent::ClimbLeftCornerInnerCheck()
 {
-	bool CanLeftCornerInner = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanLeftCornerInner;
-
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-
-	FVector LeftCornerInnerTraceEnd = CharacterLocation + CharacterForwardVector * 85;
-	FVector LeftCornerInnerTraceStart = LeftCornerInnerTraceEnd + CharacterRightVector * -85;
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, LeftCornerInnerTraceStart, LeftCornerInnerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
-	
-	float CornerInnerAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), CharacterRightVector * -1));
-
-	if (HitResult.bBlockingHit &&
-		CornerInnerAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
-
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_InnerLeft, MontagePlayInofo))
-			return false;
-
-		CanLeftCornerInner = true;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbLeftCornerInnerCheck);
 
-		FVector AdjustLocation = HitResult.ImpactPoint + CharacterRightVector * 55 -
-								 CharacterForwardVector * (50 + OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius());
-
-		OwnerCharacter->SetActorLocation(AdjustLocation, true);
-
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
-
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
-
-	return CanLeftCornerInner;
+	return ClimbCornerInnerCheck(true);
 }
 
-bool UClimbComponent::HangingRightCornerInnerCheck()
+bool UClimbComponent::ClimbCornerInnerCheck(bool bLeft)
 {
-	bool CanRightCornerInner = false;
-
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanRightCornerInner;
+		return false;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FClimbProbeResult ProbeResult;
+	if (!EvaluateProbes(EClimbProbeGroup::ClimbCornerInner, bLeft, ProbeResult))
+		return false;
 
-	FVector RightCornerInnerTraceEnd = GetTopLocation() +
-									   CharacterForwardVector * 50 + 
-									   FVector::UpVector * GHangingTraceOffsetZ;
-	FVector RightCornerInnerTraceStart = RightCornerInnerTraceEnd + CharacterRightVector * 85;
+	const FMontagePlayInofo& MontagePlayInofo = ProbeResult.MontagePlayInofo;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, RightCornerInnerTraceStart, RightCornerInnerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+	FVector CharacterSideVector = GetFrameContext().RightVector * (bLeft ? -1 : 1);
+	FVector AdjustLocation = ProbeResult.Hit.ImpactPoint +
+							 CharacterSideVector * -55 -
+							 GetFrameContext().ForwardVector * (50 + GetFrameContext().CapsuleRadius);
 
-	float CornerInnerAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), CharacterRightVector));
-	if (HitResult.bBlockingHit &&
-		CornerInnerAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
+	OwnerCharacter->SetActorLocation(AdjustLocation, true);
+	RefreshFrameContext();
 
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::Hanging_InnerRight, MontagePlayInofo))
-			return false;
+	PlayClimbMontage(MontagePlayInofo);
 
-		CanRightCornerInner = true;
+	FOnMontageBlendingOutStarted BlendingOutDelegate;
+	BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
+		{
+			ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
+			FindClimbingRotationIdle();
+		});
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
+	return true;
+}
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
+bool UClimbComponent::HangingRightCornerInnerCheck()
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HangingRightCornerInnerCheck);
 
-	return CanRightCornerInner;
+	return HangingCornerCheck(EClimbProbeGroup::HangingCornerInner, false);
 }
 
 bool UClimbComponent::HangingLeftCornerInnerCheck()
 {
-	bool CanLeftCornerInner = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return CanLeftCornerInner;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HangingLeftCornerInnerCheck);
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterLeftVector = -OwnerCharacter->GetActorRightVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-
-	FVector RightCornerInnerTraceEnd = GetTopLocation() +
-									   CharacterForwardVector * 50 +
-									   FVector::UpVector * GHangingTraceOffsetZ;
-	FVector RightCornerInnerTraceStart = RightCornerInnerTraceEnd + CharacterLeftVector * 85;
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, RightCornerInnerTraceStart, RightCornerInnerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
-
-	float CornerInnerAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), CharacterLeftVector));
-	if (HitResult.bBlockingHit &&
-		CornerInnerAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
-
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::Hanging_InnerLeft, MontagePlayInofo))
-			return false;
-
-		CanLeftCornerInner = true;
-
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
-
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
-
-	return CanLeftCornerInner;
+	return HangingCornerCheck(EClimbProbeGroup::HangingCornerInner, true);
 }
 
 bool UClimbComponent::ClimbRightCornerOuterCheck()
 {
-	bool FindClimbRightCornerOuter = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return FindClimbRightCornerOuter;
-
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-
-	FVector ClimbRightCornerOuterTraceStart = CharacterLocation;
-	FVector ClimbRightCornerOuterTraceEnd = CharacterLocation + CharacterRightVector * (CharacterCapsuleRadius + 5);
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, ClimbRightCornerOuterTraceStart, ClimbRightCornerOuterTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
-
-	float CornerOuterAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), -CharacterRightVector));
-
-	if(HitResult.bBlockingHit &&
-	   CornerOuterAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
-
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_OuterRight, MontagePlayInofo))
-			return false;
-
-		FindClimbRightCornerOuter = true;
-
-		FVector AdjustLocation = HitResult.ImpactPoint + 
-								 CharacterRightVector * MontagePlayInofo.AnimMontageOffSet.Y;
-		OwnerCharacter->SetActorLocation(AdjustLocation, true);
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbRightCornerOuterCheck);
 
-		if(bDrawDebug)
-			DrawDebugSphere(OwnerCharacter->GetWorld(), AdjustLocation, 10, 32, FColor::Yellow, false, 3);
-
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
-
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
-
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
-
-	return FindClimbRightCornerOuter;
+	return ClimbCornerOuterCheck(false);
 }
 
 bool UClimbComponent::ClimbLeftCornerOuterCheck()
 {
-	bool FindClimbLeftCornerOuter = false;
-
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return FindClimbLeftCornerOuter;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbLeftCornerOuterCheck);
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-
-	FVector ClimbLeftCornerOuterTraceStart = CharacterLocation;
-	FVector ClimbLeftCornerOuterTraceEnd = CharacterLocation + CharacterRightVector * (CharacterCapsuleRadius + 5) * -1;
-
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, ClimbLeftCornerOuterTraceStart, ClimbLeftCornerOuterTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
-
-	float CornerOuterAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), CharacterRightVector));
+	return ClimbCornerOuterCheck(true);
+}
 
-	if (HitResult.bBlockingHit &&
-		CornerOuterAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
+bool UClimbComponent::ClimbCornerOuterCheck(bool bLeft)
+{
+	if (ClimbingAnimInstance->IsAnyMontagePlaying())
+		return false;
 
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::ClimbingAction_OuterLeft, MontagePlayInofo))
-			return false;
+	FClimbProbeResult ProbeResult;
+	if (!EvaluateProbes(EClimbProbeGroup::ClimbCornerOuter, bLeft, ProbeResult))
+		return false;
 
-		FindClimbLeftCornerOuter = true;
+	const FMontagePlayInofo& MontagePlayInofo = ProbeResult.MontagePlayInofo;
 
-		FVector AdjustLocation = HitResult.ImpactPoint +
-								 CharacterRightVector * MontagePlayInofo.AnimMontageOffSet.Y;
-		OwnerCharacter->SetActorLocation(AdjustLocation, true);
+	FVector AdjustLocation = ProbeResult.Hit.ImpactPoint + 
+							 GetFrameContext().RightVector * MontagePlayInofo.AnimMontageOffSet.Y;
+	OwnerCharacter->SetActorLocation(AdjustLocation, true);
+	RefreshFrameContext();
 
-		if (bDrawDebug)
-			DrawDebugSphere(OwnerCharacter->GetWorld(), AdjustLocation, 10, 32, FColor::Yellow, false, 3);
+	if(bDrawDebug)
+		DrawDebugSphere(OwnerCharacter->GetWorld(), AdjustLocation, 10, 32, FColor::Yellow, false, 3);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	PlayClimbMontage(MontagePlayInofo);
 
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
+	FOnMontageBlendingOutStarted BlendingOutDelegate;
+	BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
+		{
+			ObstacleDetectionClimbing(150, ObstacleLocation, ObstacleNormalDir);
+			FindClimbingRotationIdle();
+		});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
+	ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
-	return FindClimbLeftCornerOuter;
+	return true;
 }
 
 bool UClimbComponent::HangingRightCornerOuterCheck()
 {
-	bool FindClimbRightCornerOuter = false;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HangingRightCornerOuterCheck);
 
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return FindClimbRightCornerOuter;
-
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-
-	FVector ClimbRightCornerOuterTraceStart = GetTopLocation() +
-											  FVector::UpVector * GHangingTraceOffsetZ +
-											  OwnerCharacter->GetActorForwardVector() * -10;
-	FVector ClimbRightCornerOuterTraceEnd = ClimbRightCornerOuterTraceStart + CharacterRightVector * (CharacterCapsuleRadius + 5);
+	return HangingCornerCheck(EClimbProbeGroup::HangingCornerOuter, false);
+}
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, ClimbRightCornerOuterTraceStart, ClimbRightCornerOuterTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+bool UClimbComponent::HangingLeftCornerOuterCheck()
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HangingLeftCornerOuterCheck);
 
-	float CornerOuterAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), -CharacterRightVector));
+	return HangingCornerCheck(EClimbProbeGroup::HangingCornerOuter, true);
+}
 
-	if (HitResult.bBlockingHit &&
-		CornerOuterAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
+bool UClimbComponent::HangingCornerCheck(EClimbProbeGroup Group, bool bLeft)
+{
+	if (ClimbingAnimInstance->IsAnyMontagePlaying())
+		return false;
 
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::Hanging_OuterRight, MontagePlayInofo))
-			return false;
+	FClimbProbeResult ProbeResult;
+	if (!EvaluateProbes(Group, bLeft, ProbeResult))
+		return false;
 
-		FindClimbRightCornerOuter = true;
+	const FMontagePlayInofo& MontagePlayInofo = ProbeResult.MontagePlayInofo;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	PlayClimbMontage(MontagePlayInofo);
 
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
+	FOnMontageBlendingOutStarted BlendingOutDelegate;
+	BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
+		{
+			ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
+			FindClimbingRotationIdle();
+		});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-	}
+	ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
-	return FindClimbRightCornerOuter;
+	return true;
 }
 
-bool UClimbComponent::HangingLeftCornerOuterCheck()
+bool UClimbComponent::EvaluateProbes(EClimbProbeGroup Group, bool bMirrored, FClimbProbeResult& OutResult)
 {
-	bool FindClimbLeftCornerOuter = false;
+	const TArray<FClimbProbe>& Probes = ClimbProbeSet != nullptr ? ClimbProbeSet->GetProbes(Group) : UClimbProbeSet::GetDefaultProbes(Group);
 
-	if (ClimbingAnimInstance->IsAnyMontagePlaying())
-		return FindClimbLeftCornerOuter;
+	const FClimbFrameContext& Context = GetFrameContext();
+	FVector SideVector = Context.RightVector * (bMirrored ? -1 : 1);
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterLeftVector = -OwnerCharacter->GetActorRightVector();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	auto ToWorld = [&Context, &SideVector](const FVector& Local)
+	{
+		return Context.ForwardVector * Local.X + SideVector * Local.Y + Context.UpVector * Local.Z;
+	};
 
-	FVector ClimbRightCornerOuterTraceStart = GetTopLocation() +
-											  FVector::UpVector * GHangingTraceOffsetZ + 
-											  OwnerCharacter->GetActorForwardVector() * -10;
-	FVector ClimbRightCornerOuterTraceEnd = ClimbRightCornerOuterTraceStart + CharacterLeftVector * (CharacterCapsuleRadius + 5);
+	for (const FClimbProbe& Probe : Probes)
+	{
+		FVector Origin = Probe.Origin == EClimbProbeOrigin::HangingTop ?
+						 GetTopLocation() + FVector::UpVector * GHangingTraceOffsetZ :
+						 Context.Location;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, ClimbRightCornerOuterTraceStart, ClimbRightCornerOuterTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		FVector TraceStart = Origin + ToWorld(Probe.Start);
+		FVector TraceEnd = Origin + ToWorld(Probe.End + Probe.EndCapsuleOffset * Context.CapsuleRadius);
 
-	float CornerOuterAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(HitResult.ImpactNormal.GetSafeNormal(), -CharacterLeftVector));
+		FHitResult ProbeHit;
+		if (Probe.Shape == ETraceShape::Sphere)
+			UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), TraceStart, TraceEnd, Probe.Radius, DetectionQueryParams, ProbeHit, bDrawDebug, FColor::Blue, FColor::Green, 3);
+		else
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, ProbeHit, bDrawDebug, FColor::Red, FColor::Green, 3);
 
-	if (HitResult.bBlockingHit &&
-		CornerOuterAngle <= 5)
-	{
-		FMontagePlayInofo MontagePlayInofo;
+		if (!ProbeHit.bBlockingHit)
+			continue;
 
-		if (!FindMontagePlayInofoByClimbAction(UClimbAction::Hanging_OuterLeft, MontagePlayInofo))
-			return false;
+		float AcceptDot = FMath::Cos(FMath::DegreesToRadians(Probe.AcceptAngle));
+		if (FVector::DotProduct(ProbeHit.ImpactNormal.GetSafeNormal(), ToWorld(Probe.AcceptNormal)) < AcceptDot)
+			continue;
 
-		FindClimbLeftCornerOuter = true;
+		if (Probe.bRequireClearPath)
+		{
+			FHitResult ClearPathHit;
+			if (Probe.Shape == ETraceShape::Sphere)
+				UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), Origin, TraceStart, Probe.Radius, DetectionQueryParams, ClearPathHit, bDrawDebug, FColor::Yellow, FColor::Green, 3);
+			else
+				UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), Origin, TraceStart, DetectionQueryParams, ClearPathHit, bDrawDebug, FColor::Yellow, FColor::Green, 3);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			if (ClearPathHit.bBlockingHit)
+				continue;
+		}
 
-		FOnMontageBlendingOutStarted BlendingOutDelegate;
-		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
-			{
-				ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
-				FindClimbingRotationIdle();
-			});
+		UClimbAction Action = bMirrored ? Probe.MirroredAction : Probe.Action;
+		if (!FindMontagePlayInofoByClimbAction(Action, OutResult.MontagePlayInofo))
+			continue;
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		OutResult.Hit = ProbeHit;
+		OutResult.Action = Action;
+		return true;
 	}
 
-	return FindClimbLeftCornerOuter;
+	return false;
 }
 
+
 bool UClimbComponent::ClimbUpActionCheck()
 {
 	bool FindUpLanding = false;
@@ -2545,11 +2732,11 @@ bool UClimbComponent::ClimbUpActionCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindUpLanding;
 
-	float ScaledCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float ScaledCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float ScaledCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float ScaledCapsuleRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 	FVector CharacterTopLocation = GetTopLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 
 	float CapsuleHeightCheck = ScaledCapsuleHalfHeight * 2;
 	float CheckRadius = 20;
@@ -2558,7 +2745,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 	FVector ObstacleWallCheckTraceStart = CharacterTopLocation + CharacterForwardVector * (2 * ScaledCapsuleRadius + 50) + FVector::UpVector * ScaledCapsuleHalfHeight;
 	FVector ObstacleWallCheckTraceEnd = CharacterTopLocation + CharacterForwardVector * (2 * ScaledCapsuleRadius + 50) + FVector::DownVector * ScaledCapsuleHalfHeight * 0.5;
 
-	FHitResult ObstacleWallCheckHitResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, ObstacleWallCheckTraceStart, ObstacleWallCheckTraceEnd, ScaledCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Orange, FColor::Green, 5);
+	FHitResult ObstacleWallCheckHitResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), ObstacleWallCheckTraceStart, ObstacleWallCheckTraceEnd, ScaledCapsuleRadius, DetectionQueryParams, ObstacleWallCheckHitResult, bDrawDebug, FColor::Orange, FColor::Green, 5);
 
 	bool ObstacleIsWall = !ObstacleWallCheckHitResult.bBlockingHit;
 
@@ -2567,7 +2755,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 		FVector UpperFloorCheckXY = GetTopLocation() + CharacterForwardVector * ScaledCapsuleRadius;
 		FVector UpperFloorCheckStart = UpperFloorCheckXY + FVector::UpVector * (CapsuleHeightCheck - CheckRadius);
 		FVector UpperFloorCheckEnd = UpperFloorCheckXY + FVector::DownVector * ScaledCapsuleHalfHeight;//for adjust
-		FHitResult UpperFloorCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+		FHitResult UpperFloorCheckHit;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, DetectionQueryParams, UpperFloorCheckHit, bDrawDebug, FColor::Red, FColor::Green, 3);
 
 		bool CanClimbUp = true;
 		float FloorAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(UpperFloorCheckHit.ImpactNormal.GetSafeNormal(), FVector::UpVector));
@@ -2589,12 +2778,12 @@ bool UClimbComponent::ClimbUpActionCheck()
 
 			FindUpLanding = true;
 
-			FVector CharaterUpVector = OwnerCharacter->GetActorUpVector();
+			FVector CharaterUpVector = GetFrameContext().UpVector;
 
 			FTransform MotionWarpingTransform;
 
 			FRotator MotionWarpingRotation;
-			MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+			MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 			MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -2612,7 +2801,7 @@ bool UClimbComponent::ClimbUpActionCheck()
 			FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 			MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 
 			FOnMontageBlendingOutStarted BlendingOutDelegate;
 			BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -2627,8 +2816,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 					ClimbingMovementComponent->BrakingDecelerationWalking = 3000;
 				});
 
-			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-			ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay);
+			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
+			ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 		}
 	}
 	else
@@ -2637,7 +2826,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 		FVector UpperFloorCheckStart = UpperFloorCheckXY + FVector::UpVector * (ScaledCapsuleHalfHeight - CheckRadius);
 		FVector UpperFloorCheckEnd = UpperFloorCheckXY + FVector::DownVector * ScaledCapsuleHalfHeight;//for adjust
 
-		FHitResult UpperFloorCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+		FHitResult UpperFloorCheckHit;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, DetectionQueryParams, UpperFloorCheckHit, bDrawDebug, FColor::Red, FColor::Green, 3);
 
 		bool CanPassVault = true;
 		//Check Character vault the top of Obstacle
@@ -2654,7 +2844,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 			FVector CharacterVaultPointFloorTraceStart = GetTopLocation() + CharacterForwardVector * (2 * ScaledCapsuleRadius + 50);
 			FVector CharacterVaultPointFloorTraceEnd = CharacterVaultPointFloorTraceStart + FVector::DownVector * (ScaledCapsuleHalfHeight * 4);
 
-			FHitResult CharacterVaultPointFloorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterVaultPointFloorTraceStart, CharacterVaultPointFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Red, 5);
+			FHitResult CharacterVaultPointFloorHitResult;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterVaultPointFloorTraceStart, CharacterVaultPointFloorTraceEnd, DetectionQueryParams, CharacterVaultPointFloorHitResult, bDrawDebug, FColor::Yellow, FColor::Red, 5);
 
 			bool CanVault = CharacterVaultPointFloorHitResult.bBlockingHit;
 
@@ -2690,7 +2881,8 @@ bool UClimbComponent::ClimbUpActionCheck()
 				FVector CharacterVaultEndPointTraceStart = UpperFloorCheckHit.ImpactPoint + CharacterForwardVector * (ScaledCapsuleRadius * 2 + 10) + FVector::DownVector * (ScaledCapsuleHalfHeight + ScaledCapsuleRadius);
 				FVector CharacterVaultEndPointTraceEnd = CharacterVaultEndPointTraceStart + CharacterForwardVector * (ScaledCapsuleRadius * 2 + 50) * -1;
 
-				FHitResult  CharacterVaultEndPointHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterVaultEndPointTraceStart, CharacterVaultEndPointTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Yellow, FColor::Red, 5);
+				FHitResult CharacterVaultEndPointHitResult;
+				UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterVaultEndPointTraceStart, CharacterVaultEndPointTraceEnd, DetectionQueryParams, CharacterVaultEndPointHitResult, bDrawDebug, FColor::Yellow, FColor::Red, 5);
 
 				FTransform MotionWarpingEndTransform;
 
@@ -2703,7 +2895,7 @@ bool UClimbComponent::ClimbUpActionCheck()
 				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingEndTarget);
 			}
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 
 			if (CanVault)
 			{
@@ -2713,7 +2905,7 @@ bool UClimbComponent::ClimbUpActionCheck()
 						SetUpDefaultState();
 					});
 
-				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 			}
 			else
 			{
@@ -2724,7 +2916,7 @@ bool UClimbComponent::ClimbUpActionCheck()
 						FindClimbingRotationIdle();
 					});
 
-				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 			}
 		}
 	}
@@ -2740,9 +2932,10 @@ bool UClimbComponent::ClimbLandingCheck()
 		return FindLanding;
 
 	FVector FindFloorTraceStart = GetFootLocation();
-	FVector FindFloorTraceEnd = FindFloorTraceStart + OwnerCharacter->GetActorUpVector() * -200;
+	FVector FindFloorTraceEnd = FindFloorTraceStart + GetFrameContext().UpVector * -200;
 
-	FHitResult FindFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FindFloorTraceStart, FindFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult FindFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FindFloorTraceStart, FindFloorTraceEnd, DetectionQueryParams, FindFloorTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	if (FindFloorTraceCheckHit.bBlockingHit)
 	{
@@ -2758,7 +2951,7 @@ bool UClimbComponent::ClimbLandingCheck()
 			FTransform MotionWarpingTransform;
 
 			FRotator MotionWarpingRotation;
-			MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+			MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 			MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -2766,7 +2959,7 @@ bool UClimbComponent::ClimbLandingCheck()
 			                                ObstacleNormalDir * MontagePlayInofo.AnimMontageOffSet.X;
 			MotionWarpingLocation.Z = MotionWarpingLocation.Z -
 									  MontagePlayInofo.AnimMontageOffSet.Y +
-									  OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+									  GetFrameContext().CapsuleHalfHeight;
 
 			MotionWarpingTransform.SetLocation(MotionWarpingLocation);
 
@@ -2776,7 +2969,7 @@ bool UClimbComponent::ClimbLandingCheck()
 			FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 			MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 		}
 
 		SetUpDefaultState();
@@ -2791,11 +2984,11 @@ bool UClimbComponent::ClimbingToHangingCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindClimbingToHanging;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	float ScaledCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float ScaledCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	float ScaledCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float ScaledCapsuleRadius = GetFrameContext().CapsuleRadius;
 
 	FVector HangingTargetTraceStart = GetFootLocation() + 
 									  CharacterForwardVector * ScaledCapsuleRadius +
@@ -2804,7 +2997,8 @@ bool UClimbComponent::ClimbingToHangingCheck()
 	FVector HangingTargetTraceEnd = HangingTargetTraceStart + 
 									FVector::UpVector * ScaledCapsuleHalfHeight;
 
-	FHitResult HangingTargetHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, HangingTargetTraceStart, HangingTargetTraceEnd, 20, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green,3);
+	FHitResult HangingTargetHit;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), HangingTargetTraceStart, HangingTargetTraceEnd, 20, DetectionQueryParams, HangingTargetHit, bDrawDebug, FColor::Red, FColor::Green,3);
 
 	
 	if(HangingTargetHit.bBlockingHit)
@@ -2819,7 +3013,8 @@ bool UClimbComponent::ClimbingToHangingCheck()
 		FVector PlayerHangingCheckEnd = PlayerHangingCheckStart +
 										FVector::DownVector * ( 2 * ScaledCapsuleHalfHeight - ScaledCapsuleRadius);
 
-		FHitResult PlayerHangingHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, PlayerHangingCheckStart, PlayerHangingCheckEnd, ScaledCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Orange, FColor::Green,3);
+		FHitResult PlayerHangingHit;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), PlayerHangingCheckStart, PlayerHangingCheckEnd, ScaledCapsuleRadius, DetectionQueryParams, PlayerHangingHit, bDrawDebug, FColor::Orange, FColor::Green,3);
 
 		if(!PlayerHangingHit.bBlockingHit)
 		{
@@ -2832,7 +3027,7 @@ bool UClimbComponent::ClimbingToHangingCheck()
 			FTransform MotionWarpingTransform;
 
 			FRotator MotionWarpingRotation;
-			MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+			MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 			MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -2848,7 +3043,7 @@ bool UClimbComponent::ClimbingToHangingCheck()
 			FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 			MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 
 			FOnMontageBlendingOutStarted BlendingOutDelegate;
 			BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -2856,7 +3051,7 @@ bool UClimbComponent::ClimbingToHangingCheck()
 					ObstacleDetectionHanging(50, ObstacleLocation, ObstacleNormalDir);
 					SetUpHangingState();
 				});
-			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 		}
 	}
 	
@@ -2870,12 +3065,12 @@ bool UClimbComponent::HangingClimbUpCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindHangingClimbUp;
 
-	float ScaledCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float ScaledCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float ScaledCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float ScaledCapsuleRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 	FVector CharacterTopLocation = GetTopLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
 
 	float CapsuleHeightCheck = ScaledCapsuleHalfHeight * 2;
 	float CheckRadius = 20;
@@ -2888,7 +3083,8 @@ bool UClimbComponent::HangingClimbUpCheck()
 	FVector LandTraceEnd = LandTraceStart +
 						   FVector::DownVector * 2 * ScaledCapsuleRadius;
 
-	FHitResult LandFloorCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, LandTraceStart, LandTraceEnd, CheckRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult LandFloorCheckHit;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), LandTraceStart, LandTraceEnd, CheckRadius, DetectionQueryParams, LandFloorCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(LandFloorCheckHit.bBlockingHit)
 	{
@@ -2900,7 +3096,8 @@ bool UClimbComponent::HangingClimbUpCheck()
 		FVector StandUpTraceEnd = StandUpTraceStart +
 								  FVector::UpVector * (CapsuleHeightCheck - 2 * ScaledCapsuleRadius);
 
-		FHitResult StandUpCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, StandUpTraceStart, StandUpTraceEnd, ScaledCapsuleRadius, TArray<AActor*>(), bDrawDebug, FColor::Orange, FColor::Green,3);
+		FHitResult StandUpCheckHit;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), StandUpTraceStart, StandUpTraceEnd, ScaledCapsuleRadius, DetectionQueryParams, StandUpCheckHit, bDrawDebug, FColor::Orange, FColor::Green,3);
 
 		if(!StandUpCheckHit.bBlockingHit)
 		{
@@ -2914,7 +3111,7 @@ bool UClimbComponent::HangingClimbUpCheck()
 			FTransform MotionWarpingTransform;
 
 			FRotator MotionWarpingRotation;
-			MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+			MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 			MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -2932,7 +3129,7 @@ bool UClimbComponent::HangingClimbUpCheck()
 
 			OwnerCharacter->GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_WorldStatic, ECollisionResponse::ECR_Ignore);
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 
 			FOnMontageBlendingOutStarted BlendingOutDelegate;
 			BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -2947,8 +3144,8 @@ bool UClimbComponent::HangingClimbUpCheck()
 					ClimbingMovementComponent->BrakingDecelerationWalking = 3000;
 				});
 
-			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-			ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay);
+			ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
+			ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 		}
 	}
 	return FindHangingClimbUp;
@@ -2961,14 +3158,15 @@ bool UClimbComponent::HangingTurnCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindHangingTurn;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
 
 	FVector HangingTurnTraceStart = GetTopLocation() + FVector::UpVector * GHangingTraceOffsetZ + CharacterForwardVector * 100;
 	FVector HangingTurnTraceEnd = HangingTurnTraceStart + CharacterForwardVector * -100;
 
-	FHitResult HangingTurnTraceHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, HangingTurnTraceStart, HangingTurnTraceEnd, {}, bDrawDebug, FColor::Orange, FColor::Green);
+	FHitResult HangingTurnTraceHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), HangingTurnTraceStart, HangingTurnTraceEnd, DetectionQueryParams, HangingTurnTraceHit, bDrawDebug, FColor::Orange, FColor::Green);
 
 	if(HangingTurnTraceHit.bBlockingHit)
 	{
@@ -2978,7 +3176,8 @@ bool UClimbComponent::HangingTurnCheck()
 		FVector HangingTargetTraceEnd = HangingTargetTraceStart + 
 										FVector::DownVector * (CharacterHalfHeight * 2);
 
-		FHitResult HangingTargetHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, HangingTargetTraceStart, HangingTargetTraceEnd, CharacterRadius, {}, bDrawDebug, FColor::Orange, FColor::Green,3);
+		FHitResult HangingTargetHit;
+		UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), HangingTargetTraceStart, HangingTargetTraceEnd, CharacterRadius, DetectionQueryParams, HangingTargetHit, bDrawDebug, FColor::Orange, FColor::Green,3);
 		if( HangingTargetHit.bBlockingHit )
 			return false;
 
@@ -2989,7 +3188,7 @@ bool UClimbComponent::HangingTurnCheck()
 
 		FindHangingTurn = true;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted BlendingOutDelegate;
 		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -2998,7 +3197,7 @@ bool UClimbComponent::HangingTurnCheck()
 				FindClimbingRotationIdle();
 			});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return FindHangingTurn;
@@ -3018,7 +3217,7 @@ bool UClimbComponent::HangingDropCheck()
 	FindHangingDrop = true;
 
 	SetUpDefaultState();
-	ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+	PlayClimbMontage(MontagePlayInofo);
 
 	return FindHangingDrop;
 }
@@ -3030,11 +3229,11 @@ bool UClimbComponent::ClimbPipeLandUpCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindClimbPipeLandUp;
 
-	float ScaledCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float ScaledCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float ScaledCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float ScaledCapsuleRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 	FVector CharacterTopLocation = GetTopLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 
 	float CapsuleHeightCheck = ScaledCapsuleHalfHeight * 2;
 	float CheckRadius = 20;
@@ -3042,7 +3241,8 @@ bool UClimbComponent::ClimbPipeLandUpCheck()
 	FVector UpperFloorCheckXY = GetTopLocation() + CharacterForwardVector * ScaledCapsuleRadius;
 	FVector UpperFloorCheckStart = UpperFloorCheckXY + FVector::UpVector * (CapsuleHeightCheck - CheckRadius);
 	FVector UpperFloorCheckEnd = UpperFloorCheckXY + FVector::DownVector * ScaledCapsuleHalfHeight;//for adjust
-	FHitResult UpperFloorCheckHit = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+	FHitResult UpperFloorCheckHit;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), UpperFloorCheckStart, UpperFloorCheckEnd, CheckRadius, DetectionQueryParams, UpperFloorCheckHit, bDrawDebug, FColor::Red, FColor::Green, 3);
 
 	bool CanClimbUp = true;
 	float FloorAngle = UKismetMathLibrary::DegAcos(FVector::DotProduct(UpperFloorCheckHit.ImpactNormal.GetSafeNormal(), FVector::UpVector));
@@ -3064,12 +3264,12 @@ bool UClimbComponent::ClimbPipeLandUpCheck()
 
 		FindClimbPipeLandUp = true;
 
-		FVector CharaterUpVector = OwnerCharacter->GetActorUpVector();
+		FVector CharaterUpVector = GetFrameContext().UpVector;
 
 		FTransform MotionWarpingTransform;
 
 		FRotator MotionWarpingRotation;
-		MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+		MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 		MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -3085,7 +3285,7 @@ bool UClimbComponent::ClimbPipeLandUpCheck()
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted BlendingOutDelegate;
 		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3100,8 +3300,8 @@ bool UClimbComponent::ClimbPipeLandUpCheck()
 				ClimbingMovementComponent->BrakingDecelerationWalking = 3000;
 			});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
-		ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
+		ClimbingAnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return FindClimbPipeLandUp;
@@ -3115,9 +3315,10 @@ bool UClimbComponent::ClimbPipeLandDownCheck()
 		return FindClimbPipeLandDown;
 
 	FVector FindFloorTraceStart = GetFootLocation();
-	FVector FindFloorTraceEnd = FindFloorTraceStart + OwnerCharacter->GetActorUpVector() * -200;
+	FVector FindFloorTraceEnd = FindFloorTraceStart + GetFrameContext().UpVector * -200;
 
-	FHitResult FindFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FindFloorTraceStart, FindFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult FindFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FindFloorTraceStart, FindFloorTraceEnd, DetectionQueryParams, FindFloorTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	if(FindFloorTraceCheckHit.bBlockingHit)
 	{
@@ -3133,7 +3334,7 @@ bool UClimbComponent::ClimbPipeLandDownCheck()
 			FTransform MotionWarpingTransform;
 
 			FRotator MotionWarpingRotation;
-			MotionWarpingRotation.Yaw = OwnerCharacter->GetActorRotation().Yaw;
+			MotionWarpingRotation.Yaw = GetFrameContext().Rotation.Yaw;
 
 			MotionWarpingTransform.SetRotation(MotionWarpingRotation.Quaternion());
 
@@ -3141,7 +3342,7 @@ bool UClimbComponent::ClimbPipeLandDownCheck()
 											ObstacleNormalDir * MontagePlayInofo.AnimMontageOffSet.X;
 			MotionWarpingLocation.Z = MotionWarpingLocation.Z - 
 									  MontagePlayInofo.AnimMontageOffSet.Y +
-									  OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+									  GetFrameContext().CapsuleHalfHeight;
 
 			MotionWarpingTransform.SetLocation(MotionWarpingLocation);
 
@@ -3151,7 +3352,7 @@ bool UClimbComponent::ClimbPipeLandDownCheck()
 			FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 			MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-			ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+			PlayClimbMontage(MontagePlayInofo);
 		}
 		SetUpDefaultState();
 	}
@@ -3161,33 +3362,37 @@ bool UClimbComponent::ClimbPipeLandDownCheck()
 
 bool UClimbComponent::ClimbPipeRightJumpCheck()
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbPipeRightJumpCheck);
+
 	bool FindClimbRightJump = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindClimbRightJump;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 
-	float CharacterCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float CharacterCapsuleRadius = GetFrameContext().CapsuleRadius;
 
 	FVector CharacterRightLocation = CharacterLocation + CharacterRightVector * CharacterCapsuleRadius;
 
 	FVector PipeTraceStart = CharacterLocation;
 	FVector PipeTraceEnd = PipeTraceStart + CharacterForwardVector * 50;
 
-	FHitResult PipeTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeTraceStart, PipeTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult PipeTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeTraceStart, PipeTraceEnd, DetectionQueryParams, PipeTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	FVector PipeRightWallTraceStart = CharacterRightLocation;
 	FVector PipeRightWallTraceEnd = CharacterRightLocation + CharacterForwardVector * 100;
 
-	FHitResult PipeRightWallTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeRightWallTraceStart, PipeRightWallTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult PipeRightWallTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeRightWallTraceStart, PipeRightWallTraceEnd, DetectionQueryParams, PipeRightWallTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	if(PipeTraceCheckHit.bBlockingHit && PipeRightWallTraceCheckHit.bBlockingHit)
 	{
-		FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
+		FVector CharacterUpVector = GetFrameContext().UpVector;
 		FVector RightCheckVector = FVector::CrossProduct(PipeRightWallTraceCheckHit.Normal, CharacterUpVector);
 
 		AActor* PipeActor = PipeTraceCheckHit.GetActor();
@@ -3196,7 +3401,11 @@ bool UClimbComponent::ClimbPipeRightJumpCheck()
 		FVector PipeRightTraceStart = FVector(PipeActorLocation.X,PipeActorLocation.Y,PipeTraceCheckHit.Location.Z);
 		FVector PipeRightTraceEnd = PipeRightTraceStart + RightCheckVector * 200;
 
-		FHitResult PipeRightTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeRightTraceStart, PipeRightTraceEnd, { PipeActor }, bDrawDebug, FColor::Blue, FColor::Green);
+		FCollisionQueryParams PipeQueryParams(SCENE_QUERY_STAT(ClimbDetection), false);
+		PipeQueryParams.AddIgnoredActor(PipeActor);
+
+		FHitResult PipeRightTraceCheckHit;
+		UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeRightTraceStart, PipeRightTraceEnd, PipeQueryParams, PipeRightTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 		if(PipeRightTraceCheckHit.bBlockingHit)
 		{
@@ -3206,12 +3415,14 @@ bool UClimbComponent::ClimbPipeRightJumpCheck()
 			FVector PipeJumpTargetTopTraceEnd = FVector(JumpTargetPipeLocation.X,JumpTargetPipeLocation.Y, PipeRightTraceCheckHit.Location.Z)+ FVector::UpVector * CharacterCapsuleHalfHeight;
 			FVector PipeJumpTargetTopTraceStart = PipeJumpTargetTopTraceEnd + PipeRightWallTraceCheckHit.Normal * 50;
 
-			FHitResult PipeJumpTargetTopTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeJumpTargetTopTraceStart, PipeJumpTargetTopTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+			FHitResult PipeJumpTargetTopTraceCheckHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeJumpTargetTopTraceStart, PipeJumpTargetTopTraceEnd, DetectionQueryParams, PipeJumpTargetTopTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 			FVector PipeJumpTargetFootTraceEnd = FVector(JumpTargetPipeLocation.X, JumpTargetPipeLocation.Y, PipeRightTraceCheckHit.Location.Z) + FVector::DownVector * CharacterCapsuleHalfHeight;
 			FVector PipeJumpTargetFootTraceStart = PipeJumpTargetFootTraceEnd + PipeRightWallTraceCheckHit.Normal * 50;
 
-			FHitResult PipeJumpTargetFootTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeJumpTargetFootTraceStart, PipeJumpTargetFootTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+			FHitResult PipeJumpTargetFootTraceCheckHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeJumpTargetFootTraceStart, PipeJumpTargetFootTraceEnd, DetectionQueryParams, PipeJumpTargetFootTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 			if(PipeJumpTargetTopTraceCheckHit.bBlockingHit && PipeJumpTargetFootTraceCheckHit.bBlockingHit)
 			{
@@ -3236,7 +3447,7 @@ bool UClimbComponent::ClimbPipeRightJumpCheck()
 				FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+				PlayClimbMontage(MontagePlayInofo);
 			}
 		}
 	}
@@ -3246,33 +3457,37 @@ bool UClimbComponent::ClimbPipeRightJumpCheck()
 
 bool UClimbComponent::ClimbPipeLeftJumpCheck()
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_ClimbPipeLeftJumpCheck);
+
 	bool FindClimbLeftJump = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return FindClimbLeftJump;
 
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterLocation = GetFrameContext().Location;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 
-	float CharacterCapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	float CharacterCapsuleRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float CharacterCapsuleRadius = GetFrameContext().CapsuleRadius;
 
 	FVector CharacterLeftLocation = CharacterLocation + -CharacterRightVector * CharacterCapsuleRadius;
 
 	FVector PipeTraceStart = CharacterLocation;
 	FVector PipeTraceEnd = PipeTraceStart + CharacterForwardVector * 50;
 
-	FHitResult PipeTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeTraceStart, PipeTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult PipeTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeTraceStart, PipeTraceEnd, DetectionQueryParams, PipeTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	FVector PipeLeftWallTraceStart = CharacterLeftLocation;
 	FVector PipeLeftWallTraceEnd = CharacterLeftLocation + CharacterForwardVector * 100;
 
-	FHitResult PipeLeftWallTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeLeftWallTraceStart, PipeLeftWallTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+	FHitResult PipeLeftWallTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeLeftWallTraceStart, PipeLeftWallTraceEnd, DetectionQueryParams, PipeLeftWallTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 	if (PipeTraceCheckHit.bBlockingHit && PipeLeftWallTraceCheckHit.bBlockingHit)
 	{
-		FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
+		FVector CharacterUpVector = GetFrameContext().UpVector;
 		FVector LeftCheckVector = -FVector::CrossProduct(PipeLeftWallTraceCheckHit.Normal, CharacterUpVector);
 
 		AActor* PipeActor = PipeTraceCheckHit.GetActor();
@@ -3281,7 +3496,11 @@ bool UClimbComponent::ClimbPipeLeftJumpCheck()
 		FVector PipeLeftTraceStart = FVector(PipeActorLocation.X, PipeActorLocation.Y, PipeTraceCheckHit.Location.Z);
 		FVector PipeLeftTraceEnd = PipeLeftTraceStart + LeftCheckVector * 200;
 
-		FHitResult PipeLeftTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeLeftTraceStart, PipeLeftTraceEnd, { PipeActor }, bDrawDebug, FColor::Blue, FColor::Green);
+		FCollisionQueryParams PipeQueryParams(SCENE_QUERY_STAT(ClimbDetection), false);
+		PipeQueryParams.AddIgnoredActor(PipeActor);
+
+		FHitResult PipeLeftTraceCheckHit;
+		UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeLeftTraceStart, PipeLeftTraceEnd, PipeQueryParams, PipeLeftTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 		if (PipeLeftTraceCheckHit.bBlockingHit)
 		{
@@ -3291,12 +3510,14 @@ bool UClimbComponent::ClimbPipeLeftJumpCheck()
 			FVector PipeJumpTargetTopTraceEnd = FVector(JumpTargetPipeLocation.X, JumpTargetPipeLocation.Y, PipeLeftTraceCheckHit.Location.Z) + FVector::UpVector * CharacterCapsuleHalfHeight;
 			FVector PipeJumpTargetTopTraceStart = PipeJumpTargetTopTraceEnd + PipeLeftTraceCheckHit.Normal * 50;
 
-			FHitResult PipeJumpTargetTopTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeJumpTargetTopTraceStart, PipeJumpTargetTopTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+			FHitResult PipeJumpTargetTopTraceCheckHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeJumpTargetTopTraceStart, PipeJumpTargetTopTraceEnd, DetectionQueryParams, PipeJumpTargetTopTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 			FVector PipeJumpTargetFootTraceEnd = FVector(JumpTargetPipeLocation.X, JumpTargetPipeLocation.Y, PipeLeftTraceCheckHit.Location.Z) + FVector::DownVector * CharacterCapsuleHalfHeight;
 			FVector PipeJumpTargetFootTraceStart = PipeJumpTargetFootTraceEnd + PipeLeftWallTraceCheckHit.Normal * 50;
 
-			FHitResult PipeJumpTargetFootTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, PipeJumpTargetFootTraceStart, PipeJumpTargetFootTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Blue, FColor::Green);
+			FHitResult PipeJumpTargetFootTraceCheckHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), PipeJumpTargetFootTraceStart, PipeJumpTargetFootTraceEnd, DetectionQueryParams, PipeJumpTargetFootTraceCheckHit, bDrawDebug, FColor::Blue, FColor::Green);
 
 			if (PipeJumpTargetTopTraceCheckHit.bBlockingHit && PipeJumpTargetFootTraceCheckHit.bBlockingHit)
 			{
@@ -3321,7 +3542,7 @@ bool UClimbComponent::ClimbPipeLeftJumpCheck()
 				FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+				PlayClimbMontage(MontagePlayInofo);
 			}
 		}
 	}
@@ -3336,20 +3557,22 @@ bool UClimbComponent::BalanceUpToWalkCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanBalanceUpToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterForwardFoot = GetFootLocation() + (CharacterRadius) * CharacterForwardVector;
 
 	FVector CharacterLeftFloorTraceStart = CharacterForwardFoot + FVector::UpVector * 30 + -CharacterRightVector * CharacterRadius * GBalanceTraceScale;
 	FVector CharacterLeftFloorTraceEnd = CharacterLeftFloorTraceStart + FVector::DownVector * 60;
 
-	FHitResult  CharacterLeftFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterLeftFloorTraceStart, CharacterLeftFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult CharacterLeftFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterLeftFloorTraceStart, CharacterLeftFloorTraceEnd, DetectionQueryParams, CharacterLeftFloorTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 	FVector CharacterRightFloorTraceStart = CharacterForwardFoot + FVector::UpVector * 30 + CharacterRightVector * CharacterRadius * GBalanceTraceScale;
 	FVector CharacterRightFloorTraceEnd = CharacterRightFloorTraceStart + FVector::DownVector * 60;
 
-	FHitResult  CharacterRightFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterRightFloorTraceStart, CharacterRightFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult CharacterRightFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterRightFloorTraceStart, CharacterRightFloorTraceEnd, DetectionQueryParams, CharacterRightFloorTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(CharacterLeftFloorTraceCheckHit.bBlockingHit && CharacterRightFloorTraceCheckHit.bBlockingHit)
 	{
@@ -3360,7 +3583,7 @@ bool UClimbComponent::BalanceUpToWalkCheck()
 
 		CanBalanceUpToWalk = true;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted BlendingOutDelegate;
 		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3368,7 +3591,7 @@ bool UClimbComponent::BalanceUpToWalkCheck()
 				SetUpDefaultState();
 			});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
 	}
 
@@ -3382,20 +3605,22 @@ bool UClimbComponent::BalanceDownToWalkCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanBalanceDownToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterBackwardFoot = GetFootLocation() + CharacterRadius * -CharacterForwardVector;
 
 	FVector CharacterLeftFloorTraceStart = CharacterBackwardFoot + FVector::UpVector * 30 + -CharacterRightVector * CharacterRadius * GBalanceTraceScale;
 	FVector CharacterLeftFloorTraceEnd = CharacterLeftFloorTraceStart + FVector::DownVector * 60;
 
-	FHitResult  CharacterLeftFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterLeftFloorTraceStart, CharacterLeftFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult CharacterLeftFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterLeftFloorTraceStart, CharacterLeftFloorTraceEnd, DetectionQueryParams, CharacterLeftFloorTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 	FVector CharacterRightFloorTraceStart = CharacterBackwardFoot + FVector::UpVector * 30 + CharacterRightVector * CharacterRadius * GBalanceTraceScale;
 	FVector CharacterRightFloorTraceEnd = CharacterRightFloorTraceStart + FVector::DownVector * 60;
 
-	FHitResult  CharacterRightFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterRightFloorTraceStart, CharacterRightFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult CharacterRightFloorTraceCheckHit;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterRightFloorTraceStart, CharacterRightFloorTraceEnd, DetectionQueryParams, CharacterRightFloorTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 	if (CharacterLeftFloorTraceCheckHit.bBlockingHit && CharacterRightFloorTraceCheckHit.bBlockingHit)
 	{
@@ -3406,7 +3631,7 @@ bool UClimbComponent::BalanceDownToWalkCheck()
 
 		CanBalanceDownToWalk = true;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted BlendingOutDelegate;
 		BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3414,7 +3639,7 @@ bool UClimbComponent::BalanceDownToWalkCheck()
 				SetUpDefaultState();
 			});
 
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 
 	}
 
@@ -3428,7 +3653,7 @@ bool UClimbComponent::BalanceTurnBackCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanBalanceTurnBack;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorRotation().Quaternion().GetForwardVector();
+	FVector CharacterForwardVector = GetFrameContext().Rotation.Quaternion().GetForwardVector();
 	FVector ControllerRotationOnyYawForwardVector = FRotator(0,OwnerCharacter->GetControlRotation().Yaw,0).Quaternion().GetForwardVector();
 
 	float Degree = UKismetMathLibrary::DegAcos(FVector::DotProduct(CharacterForwardVector, ControllerRotationOnyYawForwardVector));
@@ -3442,7 +3667,7 @@ bool UClimbComponent::BalanceTurnBackCheck()
 
 		CanBalanceTurnBack = true;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3450,7 +3675,7 @@ bool UClimbComponent::BalanceTurnBackCheck()
 				FloorDectectionBalance(FloorLocation, FloorNormalDir);
 				FindBalanceRotationIdle();
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanBalanceTurnBack;
@@ -3463,11 +3688,11 @@ bool UClimbComponent::NarrowSpaceUpToWalkCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanNarrowSpaceUpToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector CharacterTargetTraceStart = CharacterLocation +
 										CharacterForwardVector * CharacterRadius * 2 +
@@ -3479,7 +3704,8 @@ bool UClimbComponent::NarrowSpaceUpToWalkCheck()
 									  FVector::DownVector * (CharacterHalfHeight - CharacterRadius) + 
 									  -CharacterRightVector * CharacterRadius;
 
-	FHitResult  CharacterTargetTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, CharacterTargetTraceStart, CharacterTargetTraceEnd, CharacterRadius,TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+	FHitResult CharacterTargetTraceResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), CharacterTargetTraceStart, CharacterTargetTraceEnd, CharacterRadius, DetectionQueryParams, CharacterTargetTraceResult, bDrawDebug, FColor::Red, FColor::Green, 3);
 	if(!CharacterTargetTraceResult.bBlockingHit)
 	{
 		FMontagePlayInofo MontagePlayInofo;
@@ -3503,7 +3729,7 @@ bool UClimbComponent::NarrowSpaceUpToWalkCheck()
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		SetUpDefaultState(true);
 
@@ -3512,7 +3738,7 @@ bool UClimbComponent::NarrowSpaceUpToWalkCheck()
 			{
 				SetUpDefaultState();
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 	return CanNarrowSpaceUpToWalk;
 }
@@ -3524,11 +3750,11 @@ bool UClimbComponent::NarrowSpaceDownToWalkCheck()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanNarrowSpaceDownToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector CharacterTargetTraceStart = CharacterLocation +
 										-CharacterForwardVector * CharacterRadius * 2 +
@@ -3538,7 +3764,8 @@ bool UClimbComponent::NarrowSpaceDownToWalkCheck()
 									  -CharacterForwardVector * CharacterRadius * 2 +
 		                              FVector::DownVector * (CharacterHalfHeight - CharacterRadius);
 
-	FHitResult  CharacterTargetTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, CharacterTargetTraceStart, CharacterTargetTraceEnd, CharacterRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 3);
+	FHitResult CharacterTargetTraceResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), CharacterTargetTraceStart, CharacterTargetTraceEnd, CharacterRadius, DetectionQueryParams, CharacterTargetTraceResult, bDrawDebug, FColor::Red, FColor::Green, 3);
 	if (!CharacterTargetTraceResult.bBlockingHit)
 	{
 		FMontagePlayInofo MontagePlayInofo;
@@ -3560,7 +3787,7 @@ bool UClimbComponent::NarrowSpaceDownToWalkCheck()
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		SetUpDefaultState(true);
 
@@ -3569,7 +3796,7 @@ bool UClimbComponent::NarrowSpaceDownToWalkCheck()
 			{
 				SetUpDefaultState();
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanNarrowSpaceDownToWalk;
@@ -3577,22 +3804,25 @@ bool UClimbComponent::NarrowSpaceDownToWalkCheck()
 
 bool UClimbComponent::LedgeWalkUpInsideCornerCheck(bool IsRightWalk)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_LedgeWalkUpInsideCornerCheck);
+
 	bool CanLedgeWalkUpInsideCorner = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanLedgeWalkUpInsideCorner;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
-	float LedgeWalkRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.5;
+	float LedgeWalkRadius = GetFrameContext().CapsuleRadius * 0.5;
 
 	FVector UpInsideCornerTraceStart = CharacterLocation;
 	FVector UpInsideCornerTraceEnd = UpInsideCornerTraceStart + 
 									 CharacterForwardVector * (CharacterRadius + 40);
 
-	FHitResult  UpInsideCornerTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, UpInsideCornerTraceStart, UpInsideCornerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult UpInsideCornerTraceResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), UpInsideCornerTraceStart, UpInsideCornerTraceEnd, DetectionQueryParams, UpInsideCornerTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(UpInsideCornerTraceResult.bBlockingHit)
 	{
@@ -3617,7 +3847,7 @@ bool UClimbComponent::LedgeWalkUpInsideCornerCheck(bool IsRightWalk)
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3625,7 +3855,7 @@ bool UClimbComponent::LedgeWalkUpInsideCornerCheck(bool IsRightWalk)
 				bool IsRightWalk = (ClimbState == UClimbState::LedgeWalkRight);
 				ObstacleDetectionLedgeWalk(IsRightWalk, ObstacleLocation, ObstacleNormalDir);
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanLedgeWalkUpInsideCorner;
@@ -3633,22 +3863,25 @@ bool UClimbComponent::LedgeWalkUpInsideCornerCheck(bool IsRightWalk)
 
 bool UClimbComponent::LedgeWalkDownInsideCornerCheck(bool IsRightWalk)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_LedgeWalkDownInsideCornerCheck);
+
 	bool CanLedgeWalkDownInsideCorner = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanLedgeWalkDownInsideCorner;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
-	float LedgeWalkRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.5;
+	float LedgeWalkRadius = GetFrameContext().CapsuleRadius * 0.5;
 
 	FVector DownInsideCornerTraceStart = CharacterLocation;
 	FVector DownInsideCornerTraceEnd = DownInsideCornerTraceStart +
 									   -CharacterForwardVector * (CharacterRadius + 40);
 
-	FHitResult DownInsideCornerTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, DownInsideCornerTraceStart, DownInsideCornerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult DownInsideCornerTraceResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), DownInsideCornerTraceStart, DownInsideCornerTraceEnd, DetectionQueryParams, DownInsideCornerTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(DownInsideCornerTraceResult.bBlockingHit)
 	{
@@ -3673,7 +3906,7 @@ bool UClimbComponent::LedgeWalkDownInsideCornerCheck(bool IsRightWalk)
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3681,7 +3914,7 @@ bool UClimbComponent::LedgeWalkDownInsideCornerCheck(bool IsRightWalk)
 				bool IsRightWalk = (ClimbState == UClimbState::LedgeWalkRight);
 				ObstacleDetectionLedgeWalk(IsRightWalk, ObstacleLocation, ObstacleNormalDir);
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanLedgeWalkDownInsideCorner;
@@ -3689,23 +3922,26 @@ bool UClimbComponent::LedgeWalkDownInsideCornerCheck(bool IsRightWalk)
 
 bool UClimbComponent::LedgeWalkUpOutwardCornerCheck(bool IsRightWalk)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_LedgeWalkUpOutwardCornerCheck);
+
 	bool CanLedgeWalkRightUpOutwardCorner = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanLedgeWalkRightUpOutwardCorner;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
-	float LedgeWalkRightRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.5;
+	float LedgeWalkRightRadius = GetFrameContext().CapsuleRadius * 0.5;
 
 	FVector UpOutwardCornerTraceStart = CharacterLocation + CharacterForwardVector * CharacterRadius * 0.85;
 	FVector UpOutwardCornerTraceEnd = UpOutwardCornerTraceStart + TraceVector * (CharacterRadius + 10);
 
-	FHitResult UpOutsideCornerTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, UpOutwardCornerTraceStart, UpOutwardCornerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult UpOutsideCornerTraceResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), UpOutwardCornerTraceStart, UpOutwardCornerTraceEnd, DetectionQueryParams, UpOutsideCornerTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(!UpOutsideCornerTraceResult.bBlockingHit)
 	{
@@ -3730,7 +3966,7 @@ bool UClimbComponent::LedgeWalkUpOutwardCornerCheck(bool IsRightWalk)
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3738,7 +3974,7 @@ bool UClimbComponent::LedgeWalkUpOutwardCornerCheck(bool IsRightWalk)
 				bool IsRightWalk = (ClimbState == UClimbState::LedgeWalkRight);
 				ObstacleDetectionLedgeWalk(IsRightWalk, ObstacleLocation, ObstacleNormalDir);
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanLedgeWalkRightUpOutwardCorner;
@@ -3746,25 +3982,28 @@ bool UClimbComponent::LedgeWalkUpOutwardCornerCheck(bool IsRightWalk)
 
 bool UClimbComponent::LedgeWalkDownOutwardCornerCheck(bool IsRightWalk)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_LedgeWalkDownOutwardCornerCheck);
+
 	bool CanLedgeWalkDownOutwardCorner = false;
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanLedgeWalkDownOutwardCorner;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
-	float LedgeWalkRightRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.65;
+	float LedgeWalkRightRadius = GetFrameContext().CapsuleRadius * 0.65;
 
 	FVector DownOutwardCornerTraceStart = CharacterLocation +
 										  -CharacterForwardVector * CharacterRadius * 0.5;
 	FVector DownOutwardCornerTraceEnd = DownOutwardCornerTraceStart +
 										TraceVector * (CharacterRadius + 10);
 
-	FHitResult UpOutwardCornerTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, DownOutwardCornerTraceStart, DownOutwardCornerTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult UpOutwardCornerTraceResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), DownOutwardCornerTraceStart, DownOutwardCornerTraceEnd, DetectionQueryParams, UpOutwardCornerTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 	if(!UpOutwardCornerTraceResult.bBlockingHit)
 	{
@@ -3789,7 +4028,7 @@ bool UClimbComponent::LedgeWalkDownOutwardCornerCheck(bool IsRightWalk)
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -3797,7 +4036,7 @@ bool UClimbComponent::LedgeWalkDownOutwardCornerCheck(bool IsRightWalk)
 				bool IsRightWalk = (ClimbState == UClimbState::LedgeWalkRight);
 				ObstacleDetectionLedgeWalk(IsRightWalk, ObstacleLocation, ObstacleNormalDir);
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 	return CanLedgeWalkDownOutwardCorner;
 }
@@ -3809,12 +4048,12 @@ bool UClimbComponent::LedgeWalkUpLedgeWalkToWalkCheck(bool IsRightWalk)
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanUpLedgeWalkToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector UpLedgeWalkToWalkTraceStart = CharacterLocation +
 											CharacterForwardVector * CharacterRadius * 2 +
@@ -3826,7 +4065,8 @@ bool UClimbComponent::LedgeWalkUpLedgeWalkToWalkCheck(bool IsRightWalk)
 										  -TraceVector * 20 +
 										  FVector::DownVector * (CharacterHalfHeight - CharacterRadius);
 
-	FHitResult UpLedgeWalkToWalkTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, UpLedgeWalkToWalkTraceStart, UpLedgeWalkToWalkTraceEnd, CharacterRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green,3);
+	FHitResult UpLedgeWalkToWalkTraceResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), UpLedgeWalkToWalkTraceStart, UpLedgeWalkToWalkTraceEnd, CharacterRadius, DetectionQueryParams, UpLedgeWalkToWalkTraceResult, bDrawDebug, FColor::Red, FColor::Green,3);
 
 	if(!UpLedgeWalkToWalkTraceResult.bBlockingHit)
 	{
@@ -3851,14 +4091,14 @@ bool UClimbComponent::LedgeWalkUpLedgeWalkToWalkCheck(bool IsRightWalk)
 		FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 		MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
 			{
 				SetUpDefaultState();
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 	return CanUpLedgeWalkToWalk;
 }
@@ -3870,12 +4110,12 @@ bool UClimbComponent::LedgeWalkDownLedgeWalkToWalkCheck(bool IsRightWalk)
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return CanDownLedgeWalkToWalk;
 
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector DownLedgeWalkToWalkTraceStart = CharacterLocation +
 											-CharacterForwardVector * CharacterRadius * 2 + 
@@ -3887,7 +4127,8 @@ bool UClimbComponent::LedgeWalkDownLedgeWalkToWalkCheck(bool IsRightWalk)
 										  -TraceVector * 20 +
 										  FVector::DownVector * (CharacterHalfHeight - CharacterRadius);
 
-	FHitResult DownLedgeWalkToWalkTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, DownLedgeWalkToWalkTraceStart, DownLedgeWalkToWalkTraceEnd, CharacterRadius,TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green,3);
+	FHitResult DownLedgeWalkToWalkTraceResult;
+	UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), DownLedgeWalkToWalkTraceStart, DownLedgeWalkToWalkTraceEnd, CharacterRadius, DetectionQueryParams, DownLedgeWalkToWalkTraceResult, bDrawDebug, FColor::Red, FColor::Green,3);
 
 	if(!DownLedgeWalkToWalkTraceResult.bBlockingHit)
 	{
@@ -3898,27 +4139,59 @@ bool UClimbComponent::LedgeWalkDownLedgeWalkToWalkCheck(bool IsRightWalk)
 
 		CanDownLedgeWalkToWalk = true;
 
-		ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+		PlayClimbMontage(MontagePlayInofo);
 
 		FOnMontageBlendingOutStarted MontageBlendingOutDelegate;
 		MontageBlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
 			{
 				SetUpDefaultState();
 			});
-		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+		ClimbingAnimInstance->Montage_SetBlendingOutDelegate(MontageBlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 	}
 
 	return CanDownLedgeWalkToWalk;
 }
 
+const FClimbFrameContext& UClimbComponent::GetFrameContext() const
+{
+	if (!bFrameContextValid)
+		RefreshFrameContext();
+
+	return FrameContext;
+}
+
+void UClimbComponent::RefreshFrameContext() const
+{
+	const FTransform& ActorTransform = OwnerCharacter->GetActorTransform();
+	FQuat ActorQuat = ActorTransform.GetRotation();
+
+	FrameContext.Location = ActorTransform.GetLocation();
+	FrameContext.Rotation = ActorQuat.Rotator();
+	FrameContext.ForwardVector = ActorQuat.GetForwardVector();
+	FrameContext.RightVector = ActorQuat.GetRightVector();
+	FrameContext.UpVector = ActorQuat.GetUpVector();
+
+	//Crouching and scaling are the only ways the capsule changes size under us
+	UCapsuleComponent* Capsule = OwnerCharacter->GetCapsuleComponent();
+	FVector Scale = Capsule->GetComponentScale();
+	if (bCapsuleDirty || bCapsuleCrouched != OwnerCharacter->bIsCrouched || !Scale.Equals(CapsuleScale, 0))
+	{
+		FrameContext.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+		FrameContext.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+		bCapsuleCrouched = OwnerCharacter->bIsCrouched;
+		CapsuleScale = Scale;
+		bCapsuleDirty = false;
+	}
+}
+
 FVector UClimbComponent::GetFootLocation() const
 {
-	return OwnerCharacter->GetActorLocation() + OwnerCharacter->GetActorUpVector() * -1 * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() ;
+	return GetFrameContext().Location + GetFrameContext().UpVector * -1 * GetFrameContext().CapsuleHalfHeight ;
 }
 
 FVector UClimbComponent::GetTopLocation() const
 {
-	return OwnerCharacter->GetActorLocation() + OwnerCharacter->GetActorUpVector() * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	return GetFrameContext().Location + GetFrameContext().UpVector * GetFrameContext().CapsuleHalfHeight;
 }
 
 void UClimbComponent::FindClimbingRotationUp()
@@ -3999,7 +4272,7 @@ void UClimbComponent::FindClimbingRotationIdle()
 		return;
 
 	FVector FindClimbingRotationForWardVector = ObstacleNormalDir * -1;
-	FVector FindClimbingRotationUpVector = FVector::CrossProduct(OwnerCharacter->GetActorRightVector(), ObstacleNormalDir);
+	FVector FindClimbingRotationUpVector = FVector::CrossProduct(GetFrameContext().RightVector, ObstacleNormalDir);
 	FVector FindClimbingRotationRightVector = FVector::CrossProduct(FindClimbingRotationUpVector, ObstacleNormalDir) * -1;
 
 	ClimbingRotation = UKismetMathLibrary::MakeRotationFromAxes(FindClimbingRotationForWardVector, FindClimbingRotationRightVector, FindClimbingRotationUpVector);
@@ -4018,17 +4291,17 @@ void UClimbComponent::FindBalanceRotationIdle(bool UseNormal)
 	if(UseNormal)
 	{
 		BalanceRotationRightVector = FloorEndNormalDir;
-		BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationRightVector,OwnerCharacter->GetActorUpVector());
+		BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationRightVector,GetFrameContext().UpVector);
 		BalanceRotationUpVector = FVector::CrossProduct(BalanceRotationFowWardVector, BalanceRotationRightVector);
 	}
 	else
 	{
-		BalanceRotationUpVector = (OwnerCharacter->GetActorLocation() - FloorLocation).GetSafeNormal();
-		BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationUpVector, -OwnerCharacter->GetActorRightVector());
+		BalanceRotationUpVector = (GetFrameContext().Location - FloorLocation).GetSafeNormal();
+		BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationUpVector, -GetFrameContext().RightVector);
 		BalanceRotationRightVector = FVector::CrossProduct(BalanceRotationUpVector, BalanceRotationFowWardVector);
 	}
 
-	FRotator CurrentRotation = OwnerCharacter->GetActorRotation();
+	FRotator CurrentRotation = GetFrameContext().Rotation;
 	FRotator TargetRotation = UKismetMathLibrary::MakeRotationFromAxes(BalanceRotationFowWardVector, BalanceRotationRightVector, BalanceRotationUpVector);
 
 	BalanceRotation = TargetRotation;
@@ -4036,7 +4309,7 @@ void UClimbComponent::FindBalanceRotationIdle(bool UseNormal)
 
 //void UClimbComponent::FindNarrowSpaceRotationUp()
 //{
-//	FVector CharacterTargetUpVector = OwnerCharacter->GetActorUpVector();
+//	FVector CharacterTargetUpVector = GetFrameContext().UpVector;
 //	FVector CharacterTargetForwardVector = (ObstacleEndLocation - ObstacleLocation).GetSafeNormal();
 //	FVector CharacterTargetRightVector = -FVector::CrossProduct(CharacterTargetForwardVector, CharacterTargetUpVector).GetSafeNormal();
 //
@@ -4046,7 +4319,7 @@ void UClimbComponent::FindBalanceRotationIdle(bool UseNormal)
 void UClimbComponent::FindNarrowSpaceRotationIdle()
 {
 	FVector CharacterTargetRightVector = -ObstacleNormalDir;
-	FVector CharacterTargetUpVector = OwnerCharacter->GetActorUpVector();
+	FVector CharacterTargetUpVector = GetFrameContext().UpVector;
 	FVector CharacterTargetForwardVector = FVector::CrossProduct(CharacterTargetRightVector, CharacterTargetUpVector).GetSafeNormal();
 
 	NarrowSpaceRotation = UKismetMathLibrary::MakeRotationFromAxes(CharacterTargetForwardVector, CharacterTargetRightVector, CharacterTargetUpVector);
@@ -4055,7 +4328,7 @@ void UClimbComponent::FindNarrowSpaceRotationIdle()
 void UClimbComponent::FindLedgeWalkRotationIdle(bool IsRightWalk)
 {
 	FVector CharacterTargetRightVector = IsRightWalk ? -ObstacleNormalDir : ObstacleNormalDir;
-	FVector CharacterTargetUpVector = OwnerCharacter->GetActorUpVector();
+	FVector CharacterTargetUpVector = GetFrameContext().UpVector;
 	FVector CharacterTargetForwardVector = FVector::CrossProduct(CharacterTargetRightVector, CharacterTargetUpVector).GetSafeNormal();
 
 	LedgeWalkRotation = UKismetMathLibrary::MakeRotationFromAxes(CharacterTargetForwardVector, CharacterTargetRightVector, CharacterTargetUpVector);
@@ -4063,121 +4336,117 @@ void UClimbComponent::FindLedgeWalkRotationIdle(bool IsRightWalk)
 
 void UClimbComponent::HandleClimbLerpTransfor(float DeltaTime)
 {
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleClimbLerpTransfor);
 
-			IIAnimInt::Execute_INT_Direction(ClimbingAnimInstance, ClimbingDirection);
+	float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
 
-			IIAnimInt::Execute_INT_Input(ClimbingAnimInstance, MovementInput);
-		}
+	UpdateAnimDirection(ClimbingDirection);
 
-	}
+	UpdateAnimInput(MovementInput);
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
-	FVector TargetLocation = ObstacleLocation + (OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() + 10) * ObstacleNormalDir;
+	FVector CurrentLocation = GetFrameContext().Location;
+	FVector TargetLocation = ObstacleLocation + (GetFrameContext().CapsuleRadius + 10) * ObstacleNormalDir;
 
 
 	FVector ClimbLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 	OwnerCharacter->SetActorLocationAndRotation(ClimbLocation, ClimbingRotation, true);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleClimbPipeLerpTransfor(float DeltaTime)
 {
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleClimbPipeLerpTransfor);
 
-			IIAnimInt::Execute_INT_Direction(ClimbingAnimInstance, ClimbingDirection);
-		}
-	}
+	float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
+
+	UpdateAnimDirection(ClimbingDirection);
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
-	FVector TargetLocation = ObstacleLocation + (OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius()) * ObstacleNormalDir;
+	FVector CurrentLocation = GetFrameContext().Location;
+	FVector TargetLocation = ObstacleLocation + (GetFrameContext().CapsuleRadius) * ObstacleNormalDir;
 
 
 	FVector ClimbLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 	OwnerCharacter->SetActorLocationAndRotation(ClimbLocation, ClimbingRotation, true);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleHangingLerpTransfor(float DeltaTime)
 {
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleHangingLerpTransfor);
 
-			IIAnimInt::Execute_INT_Direction(ClimbingAnimInstance, ClimbingDirection);
-		}
-	}
+	float ClimbingDirection = UKismetMathLibrary::Conv_VectorToRotator(FVector(MovementInput.Y, MovementInput.X, 0)).Yaw;
+
+	UpdateAnimDirection(ClimbingDirection);
 
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	float CharaterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	float CharaterHalfHeight = GetFrameContext().CapsuleHalfHeight;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
+	FVector CurrentLocation = GetFrameContext().Location;
 	FVector TargetLocation = ObstacleLocation +
 							 ObstacleNormalDir * 5 + 
 							 FVector::UpVector * -(GHangingTraceOffsetZ + CharaterHalfHeight);
 
 	FVector ClimbLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 	OwnerCharacter->SetActorLocationAndRotation(ClimbLocation, ClimbingRotation, true);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleBalanceLerpTransfor(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleBalanceLerpTransfor);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
-	FVector TargetLocation = FloorLocation + (OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()) * FloorNormalDir;
+	FVector CurrentLocation = GetFrameContext().Location;
+	FVector TargetLocation = FloorLocation + (GetFrameContext().CapsuleHalfHeight) * FloorNormalDir;
 
 	FVector BalanceLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 	OwnerCharacter->SetActorLocationAndRotation(BalanceLocation,BalanceRotation,true);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleNarrowSpaceLerpTransfor(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleNarrowSpaceLerpTransfor);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	float NarrowSpaceRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.5;
+	float NarrowSpaceRadius = GetFrameContext().CapsuleRadius * 0.5;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
+	FVector CurrentLocation = GetFrameContext().Location;
 	FVector TargetLocation = ObstacleLocation + ObstacleNormalDir * NarrowSpaceRadius;
 
 	FVector NarrowSpaceTargetLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 
 	OwnerCharacter->SetActorLocationAndRotation(NarrowSpaceTargetLocation,NarrowSpaceRotation);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleLedgeWalkLerpTransfor(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_HandleLedgeWalkLerpTransfor);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	float LedgeWalkRightRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * 0.5;
+	float LedgeWalkRightRadius = GetFrameContext().CapsuleRadius * 0.5;
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
+	FVector CurrentLocation = GetFrameContext().Location;
 	FVector TargetLocation = ObstacleLocation + ObstacleNormalDir * (LedgeWalkRightRadius + 10);
 
 	FVector  LedgeWalkRightTargetLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, 10);
 	OwnerCharacter->SetActorLocationAndRotation(LedgeWalkRightTargetLocation, LedgeWalkRotation);
+	RefreshFrameContext();
 }
 
 void UClimbComponent::HandleClimbMoveInput()
@@ -4213,7 +4482,7 @@ void UClimbComponent::HandleHangingMoveInput()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	FVector RightDirection = OwnerCharacter->GetActorRightVector();
+	FVector RightDirection = GetFrameContext().RightVector;
 
 	OwnerCharacter->AddMovementInput(RightDirection, MovementInput.X);
 }
@@ -4223,14 +4492,7 @@ void UClimbComponent::HandleBalanceMoveInput()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_Input(ClimbingAnimInstance, MovementInput);
-		}
-	}
+	UpdateAnimInput(MovementInput);
 }
 
 void UClimbComponent::HandleNarrowSpaceMoveInput()
@@ -4238,14 +4500,7 @@ void UClimbComponent::HandleNarrowSpaceMoveInput()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_Input(ClimbingAnimInstance, MovementInput);
-		}
-	}
+	UpdateAnimInput(MovementInput);
 }
 
 void UClimbComponent::HandleLedgeWalkMoveInput()
@@ -4253,14 +4508,7 @@ void UClimbComponent::HandleLedgeWalkMoveInput()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_Input(ClimbingAnimInstance, MovementInput);
-		}
-	}
+	UpdateAnimInput(MovementInput);
 }
 
 void UClimbComponent::HandleZipLineInput()
@@ -4268,14 +4516,7 @@ void UClimbComponent::HandleZipLineInput()
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
-	if (ClimbingAnimInstance)
-	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_Input(ClimbingAnimInstance, MovementInput);
-		}
-	}
+	UpdateAnimInput(MovementInput);
 
 	if(ZipLineObj != nullptr)
 	{
@@ -4285,6 +4526,8 @@ void UClimbComponent::HandleZipLineInput()
 
 void UClimbComponent::DefaultObstacleCheck(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_DefaultObstacleCheck);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -4304,6 +4547,8 @@ void UClimbComponent::DefaultObstacleCheck(float DeltaTime)
 
 void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_DefaultFloorCheck);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -4313,15 +4558,15 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 	float MiddleTraceRadius = 10;
 
 	FVector CharacterVelocity = ClimbingMovementComponent->Velocity;
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
 
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	float LedgeWalkRadius = CharacterRadius / 2;
 
 	FVector CharacterForwardFoot = GetFootLocation() + CharacterForwardVector * CharacterRadius;
-	FVector CharacterForwardLocation = OwnerCharacter->GetActorLocation() + CharacterForwardVector * CharacterRadius;
+	FVector CharacterForwardLocation = GetFrameContext().Location + CharacterForwardVector * CharacterRadius;
 	FRotator ControllerRotaor = OwnerCharacter->GetControlRotation();
 
 	FVector CharacterForwardVectorIgnoreZ = FVector(CharacterForwardVector.X, CharacterForwardVector.Y,0).GetSafeNormal();
@@ -4335,15 +4580,17 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 		UKismetMathLibrary::DegAcos(FVector::DotProduct(CharacterForwardVectorIgnoreZ, TargetVector)) <= 5 &&
 	    ClimbState == UClimbState::Default)
 	{
-		FVector CharacterLeftFloorTraceStart = CharacterForwardFoot + FVector::UpVector * 30 + -CharacterRightVector * CharacterRadius * GBalanceTraceScale;
-		FVector CharacterLeftFloorTraceEnd = CharacterLeftFloorTraceStart + FVector::DownVector * 60;
-
-		FHitResult  CharacterLeftFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterLeftFloorTraceStart, CharacterLeftFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		FTraceHitRecord FloorTraceHitRecords[2];
+		if (!GetAsyncDetectionResults(EClimbAsyncProbe::FloorLeft, FloorTraceHitRecords))
+		{
+			FTraceRequest FloorTraceRequests[2];
+			MakeDefaultFloorTraceRequests(FloorTraceRequests);
 
-		FVector CharacterRightFloorTraceStart = CharacterForwardFoot + FVector::UpVector * 30 + CharacterRightVector * CharacterRadius * GBalanceTraceScale;
-		FVector CharacterRightFloorTraceEnd = CharacterRightFloorTraceStart + FVector::DownVector * 60;
+			UTraceBlueprintFunctionLibrary::BatchTrace(GetWorld(), FloorTraceRequests, DetectionQueryParams, FloorTraceHitRecords, bDrawDebug, FColor::Red, FColor::Green);
+		}
 
-		FHitResult  CharacterRightFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterRightFloorTraceStart, CharacterRightFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		const FTraceHitRecord& CharacterLeftFloorTraceCheckHit = FloorTraceHitRecords[0];
+		const FTraceHitRecord& CharacterRightFloorTraceCheckHit = FloorTraceHitRecords[1];
 
 		if(!CharacterLeftFloorTraceCheckHit.bBlockingHit &&
 		   !CharacterRightFloorTraceCheckHit.bBlockingHit
@@ -4352,17 +4599,27 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 			FVector CharacterMiddleFloorTraceStart = CharacterForwardFoot + FVector::UpVector * 30;
 			FVector CharacterMiddleFloorTraceEnd = CharacterMiddleFloorTraceStart + FVector::DownVector * 60;
 
-			FHitResult  CharacterMiddleFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, CharacterMiddleFloorTraceStart, CharacterMiddleFloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult CharacterMiddleFloorTraceCheckHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), CharacterMiddleFloorTraceStart, CharacterMiddleFloorTraceEnd, DetectionQueryParams, CharacterMiddleFloorTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green);
 
 			if(CharacterMiddleFloorTraceCheckHit.bBlockingHit)
 			{
 				FVector FloorTraceEnd = CharacterForwardFoot + FVector::DownVector * 5;
 
 				FVector RightFloorTraceStart = FloorTraceEnd + CharacterRightVector * CharacterRadius * GBalanceTraceScale;
-				FHitResult  RightFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, RightFloorTraceStart, FloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
-
 				FVector LeftFloorTraceStart = FloorTraceEnd + -CharacterRightVector * CharacterRadius * GBalanceTraceScale;
-				FHitResult  LeftFloorTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, LeftFloorTraceStart, FloorTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+
+				FTraceRequest FloorSideTraceRequests[2];
+				FloorSideTraceRequests[0].Start = RightFloorTraceStart;
+				FloorSideTraceRequests[0].End = FloorTraceEnd;
+				FloorSideTraceRequests[1].Start = LeftFloorTraceStart;
+				FloorSideTraceRequests[1].End = FloorTraceEnd;
+
+				FTraceHitRecord FloorSideTraceHitRecords[2];
+				UTraceBlueprintFunctionLibrary::BatchTrace(GetWorld(), FloorSideTraceRequests, DetectionQueryParams, FloorSideTraceHitRecords, bDrawDebug, FColor::Red, FColor::Green);
+
+				const FTraceHitRecord& RightFloorTraceCheckHit = FloorSideTraceHitRecords[0];
+				const FTraceHitRecord& LeftFloorTraceCheckHit = FloorSideTraceHitRecords[1];
 
 				if (RightFloorTraceCheckHit.bBlockingHit &&
 					LeftFloorTraceCheckHit.bBlockingHit &&
@@ -4374,7 +4631,7 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 						return;
 
 					FVector BalanceRotationRightVector = RightFloorTraceCheckHit.Normal;
-					FVector BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationRightVector, OwnerCharacter->GetActorUpVector());
+					FVector BalanceRotationFowWardVector = FVector::CrossProduct(BalanceRotationRightVector, GetFrameContext().UpVector);
 					FVector BalanceRotationUpVector = FVector::CrossProduct(BalanceRotationFowWardVector, BalanceRotationRightVector);
 
 					FRotator TargetRotation = UKismetMathLibrary::MakeRotationFromAxes(BalanceRotationFowWardVector, BalanceRotationRightVector, BalanceRotationUpVector);
@@ -4382,39 +4639,34 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 					FVector LastRightFloorEnd = CharacterMiddleFloorTraceCheckHit.Location;
 					FVector LastLeftFloorEnd = CharacterMiddleFloorTraceCheckHit.Location;
 
-					const int TraceUnit = 2;
-					const int QuerLength = 10;
+					//Keyed on the beam's axis, not on how the character happens to face it
+					FVector BalanceBeamAxis = BalanceRotationFowWardVector.GetSafeNormal();
 
-					for (int i = 1; i <= QuerLength; i++)
+					FClimbCachedFeature CachedBalanceBeam;
+					if (ClimbFeatureCache != nullptr && ClimbFeatureCache->FindFeature(EClimbFeatureType::BalanceBeam, CharacterMiddleFloorTraceCheckHit.Location, BalanceBeamAxis, CachedBalanceBeam))
+					{
+						//The cached end is the center of the beam, leave both ends on it
+						LastRightFloorEnd = LastLeftFloorEnd = CharacterMiddleFloorTraceCheckHit.Location + (CachedBalanceBeam.EndLocation - CachedBalanceBeam.Location);
+					}
+					else
 					{
-						FVector RightFloorEndTraceStart = CharacterMiddleFloorTraceCheckHit.Location + FVector::UpVector * 30 + CharacterRightVector * TraceUnit * i;
-						FVector RightFloorEndTraceEnd = RightFloorEndTraceStart + FVector::DownVector * 60;
+						FVector FloorEndTraceStart = CharacterMiddleFloorTraceCheckHit.Location + FVector::UpVector * 30;
+						FVector FloorEndTraceEnd = FloorEndTraceStart + FVector::DownVector * 60;
 
-						FHitResult RightFloorEndTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, RightFloorEndTraceStart, RightFloorEndTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
-						if (RightFloorEndTraceCheckHit.bBlockingHit)
+						FHitResult RightFloorEndTraceCheckHit;
+						if (UTraceBlueprintFunctionLibrary::FindEdgeExtent(GetWorld(), FloorEndTraceStart, FloorEndTraceEnd, CharacterRightVector, 20, 2, 1, DetectionQueryParams, RightFloorEndTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green, 5))
 						{
 							LastRightFloorEnd = RightFloorEndTraceCheckHit.Location;
 						}
-						else
-						{
-							break;
-						}
-					}
 
-					for (int i = 1; i <= QuerLength; i++)
-					{
-						FVector LeftFloorEndTraceStart = CharacterMiddleFloorTraceCheckHit.Location + FVector::UpVector * 30 + -CharacterRightVector * TraceUnit * i;
-						FVector LeftFloorEndTraceEnd = LeftFloorEndTraceStart + FVector::DownVector * 60;
-
-						FHitResult LeftFloorEndTraceCheckHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, LeftFloorEndTraceStart, LeftFloorEndTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green, 5);
-						if (LeftFloorEndTraceCheckHit.bBlockingHit)
+						FHitResult LeftFloorEndTraceCheckHit;
+						if (UTraceBlueprintFunctionLibrary::FindEdgeExtent(GetWorld(), FloorEndTraceStart, FloorEndTraceEnd, -CharacterRightVector, 20, 2, 1, DetectionQueryParams, LeftFloorEndTraceCheckHit, bDrawDebug, FColor::Red, FColor::Green, 5))
 						{
 							LastLeftFloorEnd = LeftFloorEndTraceCheckHit.Location;
 						}
-						else
-						{
-							break;
-						}
+
+						if (ClimbFeatureCache != nullptr)
+							ClimbFeatureCache->AddFeature(EClimbFeatureType::BalanceBeam, CharacterMiddleFloorTraceCheckHit.Location, BalanceBeamAxis, (LastLeftFloorEnd + LastRightFloorEnd) * 0.5, CharacterMiddleFloorTraceCheckHit.GetComponent());
 					}
 
 					FVector TargetLocation = (LastLeftFloorEnd + LastRightFloorEnd) * 0.5;
@@ -4430,7 +4682,7 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 					FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 					MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-					ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+					PlayClimbMontage(MontagePlayInofo);
 
 					FOnMontageBlendingOutStarted BlendingOutDelegate;
 					BlendingOutDelegate.BindLambda([this](UAnimMontage* Montage, bool bInterrupted)
@@ -4440,7 +4692,7 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 							FindBalanceRotationIdle();
 						});
 
-					ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+					ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 				}
 			}
 		}
@@ -4454,7 +4706,8 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 			FVector WallTraceStart = CharacterForwardLocation;
 			FVector WallTraceEnd = WallTraceStart + TraceVector * (CharacterRadius + 5);
 
-			FHitResult WallTraceHit = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, WallTraceStart, WallTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult WallTraceHit;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), WallTraceStart, WallTraceEnd, DetectionQueryParams, WallTraceHit, bDrawDebug, FColor::Red, FColor::Green);
 
 			if(WallTraceHit.bBlockingHit)
 			{
@@ -4481,7 +4734,7 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 				FMotionWarpingTarget MotionWarpingTarget = FMotionWarpingTarget("ClimbTarget", MotionWarpingTransform);
 				MotionWarpingComponent->AddOrUpdateWarpTarget(MotionWarpingTarget);
 
-				ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+				PlayClimbMontage(MontagePlayInofo);
 
 				SetUpLedgeWalkState(IsRightWalk);
 				SetUpLedgeWalkState(IsRightWalk, true);
@@ -4493,7 +4746,7 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 						ObstacleDetectionLedgeWalk(IsRightWalk, ObstacleLocation, ObstacleNormalDir);
 					});
 
-				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+				ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 			}
 		}
 	}
@@ -4501,6 +4754,8 @@ void UClimbComponent::DefaultFloorCheck(float DeltaTime)
 
 void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 {
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_DefaultNarrowSpaceCheck);
+
 	if (ClimbingAnimInstance->IsAnyMontagePlaying())
 		return;
 
@@ -4508,12 +4763,12 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 		return;
 
 	FVector CharacterVelocity = ClimbingMovementComponent->Velocity;
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	float CharacterHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CharacterForwardLocation = OwnerCharacter->GetActorLocation() + CharacterForwardVector * CharacterRadius;
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	FVector CharacterForwardLocation = GetFrameContext().Location + CharacterForwardVector * CharacterRadius;
 	FRotator ControllerRotaor = OwnerCharacter->GetControlRotation();
 
 	FVector CharacterForwardVectorIgnoreZ = FVector(CharacterForwardVector.X, CharacterForwardVector.Y, 0).GetSafeNormal();
@@ -4530,29 +4785,33 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 		ClimbState == UClimbState::Default)
 		
 	{
-		FVector NarrowSpaceLeftTraceStart = CharacterForwardLocation + -CharacterRightVector * (CharacterRadius - GNarrowSpaceTraceLength);
-		FVector NarrowSpaceLeftTraceEnd = NarrowSpaceLeftTraceStart + -CharacterRightVector * GNarrowSpaceTraceLength * 2;
-
-		FHitResult NarrowSpaceLeftTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, NarrowSpaceLeftTraceStart, NarrowSpaceLeftTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		FTraceHitRecord NarrowSpaceTraceHitRecords[2];
+		if (!GetAsyncDetectionResults(EClimbAsyncProbe::NarrowSpaceLeft, NarrowSpaceTraceHitRecords))
+		{
+			FTraceRequest NarrowSpaceTraceRequests[2];
+			MakeDefaultNarrowSpaceTraceRequests(NarrowSpaceTraceRequests);
 
-		FVector NarrowSpaceRightTraceStart = CharacterForwardLocation + CharacterRightVector * (CharacterRadius - GNarrowSpaceTraceLength);
-		FVector NarrowSpaceRightTraceEnd = NarrowSpaceRightTraceStart + CharacterRightVector * GNarrowSpaceTraceLength * 2;
+			UTraceBlueprintFunctionLibrary::BatchTrace(GetWorld(), NarrowSpaceTraceRequests, DetectionQueryParams, NarrowSpaceTraceHitRecords, bDrawDebug, FColor::Red, FColor::Green);
+		}
 
-		FHitResult NarrowSpaceRightTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, NarrowSpaceRightTraceStart, NarrowSpaceRightTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		const FTraceHitRecord& NarrowSpaceLeftTraceResult = NarrowSpaceTraceHitRecords[0];
+		const FTraceHitRecord& NarrowSpaceRightTraceResult = NarrowSpaceTraceHitRecords[1];
 
 		if(NarrowSpaceLeftTraceResult.bBlockingHit && NarrowSpaceRightTraceResult.bBlockingHit)
 		{
 			FVector NarrowSpaceMiddleTraceStart = CharacterForwardLocation;
 			FVector NarrowSpaceMiddleTraceEnd = NarrowSpaceMiddleTraceStart + CharacterForwardVector  * ( 2 * NarrowSpaceCheckCheckRadius);
 
-			FHitResult NarrowSpaceMiddleTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, NarrowSpaceMiddleTraceStart, NarrowSpaceMiddleTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult NarrowSpaceMiddleTraceResult;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), NarrowSpaceMiddleTraceStart, NarrowSpaceMiddleTraceEnd, DetectionQueryParams, NarrowSpaceMiddleTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 			if(!NarrowSpaceMiddleTraceResult.bBlockingHit)
 			{
 				FVector NarrowSpaceTargetRotationTraceStart = NarrowSpaceMiddleTraceStart + CharacterForwardVector  * NarrowSpaceCheckCheckRadius;
 				FVector NarrowSpaceTargetRotationTraceEnd = NarrowSpaceTargetRotationTraceStart + CharacterRightVector * (CharacterRadius * 1.5);
 
-				FHitResult NarrowSpaceTargetRotationTraceResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, NarrowSpaceTargetRotationTraceStart, NarrowSpaceTargetRotationTraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+				FHitResult NarrowSpaceTargetRotationTraceResult;
+				UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), NarrowSpaceTargetRotationTraceStart, NarrowSpaceTargetRotationTraceEnd, DetectionQueryParams, NarrowSpaceTargetRotationTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 				if(NarrowSpaceTargetRotationTraceResult.bBlockingHit)
 				{
@@ -4561,7 +4820,8 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 					FVector NarrowSpaceTargetTraceStart = NarrowSpaceTargetActorLocation + FVector::UpVector * (CharacterHalfHeight - NarrowSpaceCheckCheckRadius);
 					FVector  NarrowSpaceTargetTraceEnd = NarrowSpaceTargetActorLocation + FVector::DownVector * (CharacterHalfHeight - NarrowSpaceCheckCheckRadius);
 
-					FHitResult NarrowSpaceTargetTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(OwnerCharacter, NarrowSpaceTargetTraceStart, NarrowSpaceTargetTraceEnd, NarrowSpaceCheckCheckRadius, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+					FHitResult NarrowSpaceTargetTraceResult;
+					UTraceBlueprintFunctionLibrary::SphereTrace(GetWorld(), NarrowSpaceTargetTraceStart, NarrowSpaceTargetTraceEnd, NarrowSpaceCheckCheckRadius, DetectionQueryParams, NarrowSpaceTargetTraceResult, bDrawDebug, FColor::Red, FColor::Green);
 
 					if (!NarrowSpaceTargetTraceResult.bBlockingHit)
 					{
@@ -4590,7 +4850,7 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 						ClimbingMovementComponent->SetMovementMode(EMovementMode::MOVE_Flying);
 						OwnerCharacter->GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_WorldStatic, ECollisionResponse::ECR_Ignore);
 						
-						ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay);
+						PlayClimbMontage(MontagePlayInofo);
 
 						SetUpNarrowSpaceState(true);
 
@@ -4601,7 +4861,7 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 								ObstacleDetectionNarrowSpace(ObstacleLocation, ObstacleNormalDir);
 							});
 
-						ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay);
+						ClimbingAnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, MontagePlayInofo.AnimMontageToPlay.Get());
 					}
 				}
 			}
@@ -4609,13 +4869,359 @@ void UClimbComponent::DefaultNarrowSpaceCheck(float DeltaTime)
 	}
 }
 
+FTraceRequest UClimbComponent::MakeObstacleDetectionDefaultRequest(float MinDistance, float MaxDistance, const FVector& Velocity) const
+{
+	float Distance = FMath::GetMappedRangeValueClamped(FVector2f(0, MaxDistance / 5), FVector2f(MinDistance, MaxDistance), Velocity.Length());
+
+	FTraceRequest TraceRequest;
+	TraceRequest.Start = GetFrameContext().Location;
+	TraceRequest.End = GetFrameContext().ForwardVector * Distance + TraceRequest.Start;
+
+	return TraceRequest;
+}
+
+FTraceRequest UClimbComponent::MakeHangingObstacleDetectionDefaultRequest(float MinDistance, float MaxDistance, const FVector& Velocity) const
+{
+	float CharacterHalfHeight = GetFrameContext().CapsuleHalfHeight;
+	float Distance = FMath::GetMappedRangeValueClamped(FVector2f(0, MaxDistance / 5), FVector2f(MinDistance, MaxDistance), Velocity.Size2D());
+	float Height = FMath::GetMappedRangeValueClamped(FVector2f(-5 * CharacterHalfHeight, 5 * CharacterHalfHeight), FVector2f(-(CharacterHalfHeight - 10), (CharacterHalfHeight - 10)), Velocity.Z);
+
+	FTraceRequest TraceRequest;
+	TraceRequest.Shape = ETraceShape::Sphere;
+	TraceRequest.Radius = 5;
+	//TraceRequest.Start = GetFootLocation() + FVector::UpVector * 10;
+	TraceRequest.Start = GetFrameContext().Location + FVector::UpVector * Height;
+	TraceRequest.End = GetFrameContext().ForwardVector * Distance + TraceRequest.Start;
+
+	return TraceRequest;
+}
+
+FTraceRequest UClimbComponent::MakeZipLineDetectionRequest() const
+{
+	FVector CharacterLocation = GetFrameContext().Location;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	float CharacterCapsuleHalfHeight = GetFrameContext().CapsuleHalfHeight;
+
+	FTraceRequest TraceRequest;
+	TraceRequest.Shape = ETraceShape::Sphere;
+	TraceRequest.Radius = CharacterRadius;
+	TraceRequest.Start = CharacterLocation + FVector::UpVector * CharacterCapsuleHalfHeight;
+	TraceRequest.End = CharacterLocation + FVector::UpVector * 2 * (CharacterCapsuleHalfHeight - CharacterRadius);
+	TraceRequest.CollisionChannel = ECollisionChannel::ECC_GameTraceChannel1;
+
+	return TraceRequest;
+}
+
+void UClimbComponent::MakeDefaultFloorTraceRequests(TArrayView<FTraceRequest> OutRequests) const
+{
+	check(OutRequests.Num() >= 2);
+
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterForwardFoot = GetFootLocation() + GetFrameContext().ForwardVector * CharacterRadius;
+
+	OutRequests[0].Start = CharacterForwardFoot + FVector::UpVector * 30 + -CharacterRightVector * CharacterRadius * GBalanceTraceScale;
+	OutRequests[0].End = OutRequests[0].Start + FVector::DownVector * 60;
+
+	OutRequests[1].Start = CharacterForwardFoot + FVector::UpVector * 30 + CharacterRightVector * CharacterRadius * GBalanceTraceScale;
+	OutRequests[1].End = OutRequests[1].Start + FVector::DownVector * 60;
+}
+
+void UClimbComponent::MakeDefaultNarrowSpaceTraceRequests(TArrayView<FTraceRequest> OutRequests) const
+{
+	check(OutRequests.Num() >= 2);
+
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterForwardLocation = GetFrameContext().Location + GetFrameContext().ForwardVector * CharacterRadius;
+
+	OutRequests[0].Start = CharacterForwardLocation + -CharacterRightVector * (CharacterRadius - GNarrowSpaceTraceLength);
+	OutRequests[0].End = OutRequests[0].Start + -CharacterRightVector * GNarrowSpaceTraceLength * 2;
+
+	OutRequests[1].Start = CharacterForwardLocation + CharacterRightVector * (CharacterRadius - GNarrowSpaceTraceLength);
+	OutRequests[1].End = OutRequests[1].Start + CharacterRightVector * GNarrowSpaceTraceLength * 2;
+}
+
+bool UClimbComponent::ShouldRunDetection(float DeltaTime)
+{
+	DetectionElapsedTime += DeltaTime;
+
+	//A new state always runs its first pass right away
+	bool bStateChanged = ClimbState != LastDetectionState;
+	if (!bStateChanged && DetectionElapsedTime < GetDetectionInterval())
+		return false;
+
+	//Other characters wait for their share of the world's trace budget and keep acting on their last results meanwhile
+	if (!bStateChanged && TraceBudget != nullptr && UClimbTraceBudgetSubsystem::IsBudgetEnabled() && !OwnerCharacter->IsLocallyControlled())
+	{
+		if (!TraceBudget->RequestDetection(this, DetectionSignificance, EstimatedDetectionTraces))
+			return false;
+	}
+
+	LastDetectionState = ClimbState;
+	DetectionDeltaTime = DetectionElapsedTime;
+	DetectionElapsedTime = 0;
+
+	return true;
+}
+
+float UClimbComponent::GetDetectionInterval() const
+{
+	if (!bUseDetectionScheduler || !bComponentInitalize)
+		return 0;
+
+	const FClimbDetectionRate* DetectionRate = DetectionRates.Find(ClimbState);
+	if (DetectionRate == nullptr)
+		return 0;
+
+	bool IsIdle = MovementInput.IsNearlyZero() && ClimbingMovementComponent->Velocity.SizeSquared() < 1;
+	float Interval = IsIdle ? DetectionRate->IdleInterval : DetectionRate->MovingInterval;
+
+	float Significance = OwnerCharacter->IsLocallyControlled() ? 1 : DetectionSignificance;
+
+	return FMath::Lerp(FMath::Max(Interval, DetectionRate->InsignificantInterval), Interval, Significance);
+}
+
+float UClimbComponent::CalculateSignificance(const FTransform& Viewpoint) const
+{
+	if (OwnerCharacter == nullptr)
+		return 0;
+
+	if (OwnerCharacter->IsLocallyControlled())
+		return 1;
+
+	//Called from the significance manager's update, which may run in parallel, so the frame context is left alone
+	float Distance = FVector::Dist(OwnerCharacter->GetActorLocation(), Viewpoint.GetLocation());
+	float Significance = 1 - FMath::Clamp(Distance / SignificanceDistance, 0.f, 1.f);
+
+	//Off screen characters only need to look right once they are seen again, a dedicated server renders nothing
+	if (GetNetMode() != NM_DedicatedServer && !OwnerCharacter->WasRecentlyRendered(0.2))
+		Significance *= 0.5;
+
+	return Significance;
+}
+
+void UClimbComponent::IssueAsyncDetectionProbes(float DeltaTime)
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_IssueAsyncDetectionProbes);
+
+	//Results are only good for the frame right after they were issued
+	for (bool& bHitValid : bAsyncDetectionHitValid)
+	{
+		bHitValid = false;
+	}
+
+	if (!bAsyncDetection || !bComponentInitalize)
+		return;
+
+	if (ClimbState != UClimbState::Default || ClimbingAnimInstance->IsAnyMontagePlaying())
+		return;
+
+	//Only pay for probes the scheduler will consume next frame
+	if (ClimbState == LastDetectionState && DetectionElapsedTime + DeltaTime < GetDetectionInterval())
+		return;
+
+	if (ProbeSubsystem != nullptr && UClimbProbeSubsystem::IsEnabled())
+	{
+		QueueBatchedDetectionProbes();
+		return;
+	}
+
+	//Same distances as the synchronous calls in ObstacleCheckDefault
+	if (ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Falling)
+	{
+		FVector CurrentVelocity = ClimbingMovementComponent->Velocity;
+
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::Obstacle, MakeObstacleDetectionDefaultRequest(50, 100, CurrentVelocity), DetectionQueryParams);
+		//Also with the feature index, it is the fallback for ledges the bake did not cover
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::HangingObstacle, MakeHangingObstacleDetectionDefaultRequest(100, 200, CurrentVelocity), DetectionIgnoreOwnerQueryParams);
+		if (!UsesZipLineIndex())
+			IssueAsyncDetectionProbe(EClimbAsyncProbe::ZipLine, MakeZipLineDetectionRequest(), DetectionQueryParams);
+	}
+	else if (ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Walking)
+	{
+		FTraceRequest FloorTraceRequests[2];
+		MakeDefaultFloorTraceRequests(FloorTraceRequests);
+
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::FloorLeft, FloorTraceRequests[0], DetectionQueryParams);
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::FloorRight, FloorTraceRequests[1], DetectionQueryParams);
+
+		FTraceRequest NarrowSpaceTraceRequests[2];
+		MakeDefaultNarrowSpaceTraceRequests(NarrowSpaceTraceRequests);
+
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::NarrowSpaceLeft, NarrowSpaceTraceRequests[0], DetectionQueryParams);
+		IssueAsyncDetectionProbe(EClimbAsyncProbe::NarrowSpaceRight, NarrowSpaceTraceRequests[1], DetectionQueryParams);
+	}
+}
+
+void UClimbComponent::QueueBatchedDetectionProbes()
+{
+	using FProbeLayout = UClimbProbeSubsystem::FProbeLayout;
+
+	const FClimbFrameContext& Context = GetFrameContext();
+	float Radius = Context.CapsuleRadius;
+	float HalfHeight = Context.CapsuleHalfHeight;
+
+	//Offsets are (Forward, Right, Up, world up), mirroring the Make*Request functions
+	TArray<FProbeLayout, TInlineAllocator<UClimbProbeSubsystem::MaxProbes>> Probes;
+
+	if (ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Falling)
+	{
+		FVector CurrentVelocity = ClimbingMovementComponent->Velocity;
+
+		FProbeLayout& Obstacle = Probes.AddDefaulted_GetRef();
+		Obstacle.Probe = EClimbAsyncProbe::Obstacle;
+		Obstacle.EndOffset = FVector4f(FMath::GetMappedRangeValueClamped(FVector2f(0, 100 / 5), FVector2f(50, 100), CurrentVelocity.Length()), 0, 0, 0);
+
+		//Also with the feature index, it is the fallback for ledges the bake did not cover
+		{
+			float Distance = FMath::GetMappedRangeValueClamped(FVector2f(0, 200 / 5), FVector2f(100, 200), CurrentVelocity.Size2D());
+			float Height = FMath::GetMappedRangeValueClamped(FVector2f(-5 * HalfHeight, 5 * HalfHeight), FVector2f(-(HalfHeight - 10), (HalfHeight - 10)), CurrentVelocity.Z);
+
+			FProbeLayout& HangingObstacle = Probes.AddDefaulted_GetRef();
+			HangingObstacle.Probe = EClimbAsyncProbe::HangingObstacle;
+			HangingObstacle.Shape = ETraceShape::Sphere;
+			HangingObstacle.Radius = 5;
+			HangingObstacle.bIgnoreOwner = true;
+			HangingObstacle.StartOffset = FVector4f(0, 0, 0, Height);
+			HangingObstacle.EndOffset = FVector4f(Distance, 0, 0, Height);
+		}
+
+		if (!UsesZipLineIndex())
+		{
+			FProbeLayout& ZipLine = Probes.AddDefaulted_GetRef();
+			ZipLine.Probe = EClimbAsyncProbe::ZipLine;
+			ZipLine.Shape = ETraceShape::Sphere;
+			ZipLine.Radius = Radius;
+			ZipLine.CollisionChannel = ECollisionChannel::ECC_GameTraceChannel1;
+			ZipLine.StartOffset = FVector4f(0, 0, 0, HalfHeight);
+			ZipLine.EndOffset = FVector4f(0, 0, 0, 2 * (HalfHeight - Radius));
+		}
+	}
+	else if (ClimbingMovementComponent->MovementMode == EMovementMode::MOVE_Walking)
+	{
+		float BalanceOffset = Radius * GBalanceTraceScale;
+
+		FProbeLayout& FloorLeft = Probes.AddDefaulted_GetRef();
+		FloorLeft.Probe = EClimbAsyncProbe::FloorLeft;
+		FloorLeft.StartOffset = FVector4f(Radius, -BalanceOffset, -HalfHeight, 30);
+		FloorLeft.EndOffset = FVector4f(Radius, -BalanceOffset, -HalfHeight, -30);
+
+		FProbeLayout& FloorRight = Probes.AddDefaulted_GetRef();
+		FloorRight.Probe = EClimbAsyncProbe::FloorRight;
+		FloorRight.StartOffset = FVector4f(Radius, BalanceOffset, -HalfHeight, 30);
+		FloorRight.EndOffset = FVector4f(Radius, BalanceOffset, -HalfHeight, -30);
+
+		FProbeLayout& NarrowSpaceLeft = Probes.AddDefaulted_GetRef();
+		NarrowSpaceLeft.Probe = EClimbAsyncProbe::NarrowSpaceLeft;
+		NarrowSpaceLeft.StartOffset = FVector4f(Radius, -(Radius - GNarrowSpaceTraceLength), 0, 0);
+		NarrowSpaceLeft.EndOffset = FVector4f(Radius, -(Radius + GNarrowSpaceTraceLength), 0, 0);
+
+		FProbeLayout& NarrowSpaceRight = Probes.AddDefaulted_GetRef();
+		NarrowSpaceRight.Probe = EClimbAsyncProbe::NarrowSpaceRight;
+		NarrowSpaceRight.StartOffset = FVector4f(Radius, Radius - GNarrowSpaceTraceLength, 0, 0);
+		NarrowSpaceRight.EndOffset = FVector4f(Radius, Radius + GNarrowSpaceTraceLength, 0, 0);
+	}
+
+	if (Probes.Num() > 0)
+		ProbeSubsystem->AddClimber(this, Context, Probes);
+}
+
+bool UClimbComponent::UsesZipLineIndex() const
+{
+	return ZipLineSubsystem != nullptr && UClimbZipLineSubsystem::IsEnabled();
+}
+
+void UClimbComponent::IssueAsyncDetectionProbe(EClimbAsyncProbe Probe, const FTraceRequest& Request, const FCollisionQueryParams& QueryParams)
+{
+	INC_DWORD_STAT(STAT_ClimbAsyncTraces);
+
+	int32 ProbeIndex = (int32)Probe;
+	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(Request.CollisionChannel.GetValue()));
+
+	AsyncDetectionTraceHandles[ProbeIndex] = (Request.Shape == ETraceShape::Line) ?
+		GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Request.Start, Request.End, CollisionObjectQueryParams, QueryParams, &AsyncDetectionTraceDelegate, ProbeIndex) :
+		GetWorld()->AsyncSweepByObjectType(EAsyncTraceType::Single, Request.Start, Request.End, FQuat::Identity, CollisionObjectQueryParams, FCollisionShape::MakeSphere(Request.Radius), QueryParams, &AsyncDetectionTraceDelegate, ProbeIndex);
+}
+
+void UClimbComponent::OnAsyncDetectionTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	int32 ProbeIndex = (int32)TraceDatum.UserData;
+	if (ProbeIndex < 0 || ProbeIndex >= (int32)EClimbAsyncProbe::Num)
+		return;
+
+	//Ignore results of probes that have been issued again since
+	if (AsyncDetectionTraceHandles[ProbeIndex] != TraceHandle)
+		return;
+
+	FHitResult& HitResult = AsyncDetectionHitResults[ProbeIndex];
+	HitResult = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult(TraceDatum.Start, TraceDatum.End);
+
+	bAsyncDetectionHitValid[ProbeIndex] = true;
+
+	Telemetry.RecordTrace(TraceDatum.CollisionParams.CollisionShape.IsLine() ? ETraceShape::Line : ETraceShape::Sphere, HitResult.bBlockingHit);
+
+	if (bDrawDebug)
+	{
+#if ENABLE_DRAW_DEBUG
+		if (TraceDatum.CollisionParams.CollisionShape.IsSphere())
+		{
+			DrawDebugSphereTraceSingle(GetWorld(), TraceDatum.Start, TraceDatum.End, TraceDatum.CollisionParams.CollisionShape.GetSphereRadius(), EDrawDebugTrace::ForDuration, HitResult.bBlockingHit, HitResult, FColor::Red, FColor::Green, 0);
+		}
+		else
+		{
+			DrawDebugLineTraceSingle(GetWorld(), TraceDatum.Start, TraceDatum.End, EDrawDebugTrace::ForDuration, HitResult.bBlockingHit, HitResult, FColor::Red, FColor::Green, 0);
+		}
+#endif
+	}
+}
+
+bool UClimbComponent::GetAsyncDetectionResult(EClimbAsyncProbe Probe, FHitResult& OutHitResult)
+{
+	int32 ProbeIndex = (int32)Probe;
+	if (bAsyncDetection)
+		Telemetry.RecordAsyncResult(bAsyncDetectionHitValid[ProbeIndex]);
+
+	if (!bAsyncDetectionHitValid[ProbeIndex])
+		return false;
+
+	OutHitResult = AsyncDetectionHitResults[ProbeIndex];
+
+	return true;
+}
+
+bool UClimbComponent::GetAsyncDetectionResults(EClimbAsyncProbe FirstProbe, TArrayView<FTraceHitRecord> OutHitRecords)
+{
+	int32 FirstProbeIndex = (int32)FirstProbe;
+	check(FirstProbeIndex + OutHitRecords.Num() <= (int32)EClimbAsyncProbe::Num);
+
+	bool bAllValid = true;
+	for (int32 i = 0; i < OutHitRecords.Num(); i++)
+	{
+		bAllValid &= bAsyncDetectionHitValid[FirstProbeIndex + i];
+	}
+
+	if (bAsyncDetection)
+		Telemetry.RecordAsyncResult(bAllValid);
+
+	if (!bAllValid)
+		return false;
+
+	for (int32 i = 0; i < OutHitRecords.Num(); i++)
+	{
+		OutHitRecords[i] = UTraceBlueprintFunctionLibrary::MakeTraceHitRecord(AsyncDetectionHitResults[FirstProbeIndex + i]);
+	}
+
+	return true;
+}
+
 void UClimbComponent::SetUpDefaultState(bool OnlyChangeState /*= false*/)
 {
 	ClimbState = UClimbState::Default;
 
 	if(OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4629,18 +5235,15 @@ void UClimbComponent::SetUpDefaultState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
 	}
 
-	FRotator CharacterRotation = OwnerCharacter->GetActorRotation();
+	FRotator CharacterRotation = GetFrameContext().Rotation;
     if(CharacterRotation.Pitch != 0)
 	{
 		OwnerCharacter->SetActorRotation(FRotator(0, CharacterRotation.Yaw,0));
+		RefreshFrameContext();
 	}
 
 	OwnerCharacter->GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_WorldStatic, ECollisionResponse::ECR_Block);
@@ -4652,7 +5255,7 @@ void UClimbComponent::SetUpClimbingState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4666,11 +5269,7 @@ void UClimbComponent::SetUpClimbingState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
 	}
 
@@ -4683,7 +5282,7 @@ void UClimbComponent::SetUpClimbingPipeState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4697,11 +5296,7 @@ void UClimbComponent::SetUpClimbingPipeState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
 	}
 
@@ -4714,7 +5309,7 @@ void UClimbComponent::SetUpHangingState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4728,11 +5323,7 @@ void UClimbComponent::SetUpHangingState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
 	}
 
@@ -4746,7 +5337,7 @@ void UClimbComponent::SetUpBalanceState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4760,11 +5351,7 @@ void UClimbComponent::SetUpBalanceState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromEverything);
 	}
 
@@ -4777,7 +5364,7 @@ void UClimbComponent::SetUpNarrowSpaceState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4791,11 +5378,7 @@ void UClimbComponent::SetUpNarrowSpaceState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromEverything);
 	}
 
@@ -4808,7 +5391,7 @@ void UClimbComponent::SetUpLedgeWalkState(bool IsRightWalk, bool OnlyChangeState
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4821,11 +5404,7 @@ void UClimbComponent::SetUpLedgeWalkState(bool IsRightWalk, bool OnlyChangeState
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromEverything);
 	}
 
@@ -4838,7 +5417,7 @@ void UClimbComponent::SetUpZipLineState(bool OnlyChangeState /*= false*/)
 
 	if (OnlyChangeState)
 	{
-		FRotator PreRotator = OwnerCharacter->GetActorRotation();
+		FRotator PreRotator = GetFrameContext().Rotation;
 		PreRotator.Roll = 0;
 
 		OwnerCharacter->GetController()->SetControlRotation(PreRotator);
@@ -4852,27 +5431,24 @@ void UClimbComponent::SetUpZipLineState(bool OnlyChangeState /*= false*/)
 
 	if (ClimbingAnimInstance)
 	{
-		UClass* ActorClass = ClimbingAnimInstance->GetClass();
-		if (ActorClass->ImplementsInterface(UIAnimInt::StaticClass()))
-		{
-			IIAnimInt::Execute_INT_ChangeClimbPosture(ClimbingAnimInstance, ClimbState);
-		}
+		UpdateAnimClimbPosture(ClimbState);
 		ClimbingAnimInstance->SetRootMotionMode(ERootMotionMode::RootMotionFromMontagesOnly);
 	}
 }
 
 bool UClimbComponent::ObstacleEndDetectionUp(float Distance, FVector& Location)
 {
-	FVector CharactorLocation = OwnerCharacter->GetActorLocation();
+	FVector CharactorLocation = GetFrameContext().Location;
 	FVector OToCVector = CharactorLocation - ObstacleLocation;
 
 	float CosCToOVectorToObstacleNormalDir = FVector::DotProduct(OToCVector.GetSafeNormal(), ObstacleNormalDir);
 
 
-	FVector TraceStart = ObstacleLocation + CosCToOVectorToObstacleNormalDir * OToCVector.Length()* ObstacleNormalDir + OwnerCharacter->GetActorUpVector() * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	FVector TraceStart = ObstacleLocation + CosCToOVectorToObstacleNormalDir * OToCVector.Length()* ObstacleNormalDir + GetFrameContext().UpVector * GetFrameContext().CapsuleHalfHeight;
 	FVector TraceEnd = TraceStart + ObstacleNormalDir * Distance * -1;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -4883,10 +5459,11 @@ bool UClimbComponent::ObstacleEndDetectionUp(float Distance, FVector& Location)
 
 bool UClimbComponent::ObstacleEndDetectionRight(float Distance, FVector& Location)
 {
-	FVector TraceStart = OwnerCharacter->GetActorLocation() + OwnerCharacter->GetActorRightVector() * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector TraceEnd = TraceStart + OwnerCharacter->GetActorForwardVector() * Distance;
+	FVector TraceStart = GetFrameContext().Location + GetFrameContext().RightVector * GetFrameContext().CapsuleRadius;
+	FVector TraceEnd = TraceStart + GetFrameContext().ForwardVector * Distance;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -4897,10 +5474,11 @@ bool UClimbComponent::ObstacleEndDetectionRight(float Distance, FVector& Locatio
 
 bool UClimbComponent::ObstacleEndDetectionLeft(float Distance, FVector& Location)
 {	
-	FVector TraceStart = OwnerCharacter->GetActorLocation() + OwnerCharacter->GetActorRightVector() * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius() * -1;
-	FVector TraceEnd = TraceStart + OwnerCharacter->GetActorForwardVector() * Distance;
+	FVector TraceStart = GetFrameContext().Location + GetFrameContext().RightVector * GetFrameContext().CapsuleRadius * -1;
+	FVector TraceEnd = TraceStart + GetFrameContext().ForwardVector * Distance;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -4912,9 +5490,10 @@ bool UClimbComponent::ObstacleEndDetectionLeft(float Distance, FVector& Location
 bool UClimbComponent::ObstacleEndDetectionDown(float Distance, FVector& Location)
 {
 	FVector TraceStart = GetFootLocation();
-	FVector TraceEnd = TraceStart + OwnerCharacter->GetActorForwardVector() * Distance;
+	FVector TraceEnd = TraceStart + GetFrameContext().ForwardVector * Distance;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -4927,11 +5506,12 @@ bool UClimbComponent::HangingEndDetectionRight(float Distance, FVector& Locatoon
 {
 	FVector TreceStart = GetTopLocation() +
 						 FVector::UpVector * GHangingTraceOffsetZ +
-						 OwnerCharacter->GetActorForwardVector() * -10 +
-						 OwnerCharacter->GetActorRightVector() * OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TreceStart;
+						 GetFrameContext().ForwardVector * -10 +
+						 GetFrameContext().RightVector * GetFrameContext().CapsuleRadius;
+	FVector TraceEnd = GetFrameContext().ForwardVector * Distance + TreceStart;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TreceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TreceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Locatoon = HitResult.ImpactPoint;
@@ -4944,11 +5524,12 @@ bool UClimbComponent::HangingEndDetectionLeft(float Distance, FVector& Locatoon)
 {
 	FVector TraceStart = GetTopLocation() +
 						 FVector::UpVector * GHangingTraceOffsetZ +
-						 OwnerCharacter->GetActorForwardVector() * -10 +
-						 OwnerCharacter->GetActorRightVector() * -OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector TraceEnd = OwnerCharacter->GetActorForwardVector() * Distance + TraceStart;
+						 GetFrameContext().ForwardVector * -10 +
+						 GetFrameContext().RightVector * -GetFrameContext().CapsuleRadius;
+	FVector TraceEnd = GetFrameContext().ForwardVector * Distance + TraceStart;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Locatoon = HitResult.ImpactPoint;
@@ -4959,15 +5540,16 @@ bool UClimbComponent::HangingEndDetectionLeft(float Distance, FVector& Locatoon)
 
 bool UClimbComponent::BalanceEndDectionUp(FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterForwardFoot = GetFootLocation() + (CharacterRadius) * CharacterForwardVector;
 
 	FVector TraceStart = CharacterForwardFoot + FVector::UpVector * 30;
 	FVector TraceEnd = TraceStart + FVector::DownVector * 60;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if(HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -4983,7 +5565,8 @@ bool UClimbComponent::BalanceEndDectionUp(FVector& Location, FVector& Normal)
 
 		//TraceLeftFoor
 		FVector TraceLeftFoorEnd = FloorTraceStart + CharacterRightVector * -CharacterRadius * 0.5;
-		FHitResult TraceLeftFoorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FloorTraceStart, TraceLeftFoorEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		FHitResult TraceLeftFoorHitResult;
+		UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FloorTraceStart, TraceLeftFoorEnd, DetectionQueryParams, TraceLeftFoorHitResult, bDrawDebug, FColor::Red, FColor::Green);
 
 		if(TraceLeftFoorHitResult.bBlockingHit)
 		{
@@ -4993,7 +5576,8 @@ bool UClimbComponent::BalanceEndDectionUp(FVector& Location, FVector& Normal)
 		{
 			//TraceRightFoor
 			FVector TraceRightFoorEnd = FloorTraceStart + CharacterRightVector * CharacterRadius * 0.5;
-			FHitResult TraceRightFoorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FloorTraceStart, TraceRightFoorEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult TraceRightFoorHitResult;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FloorTraceStart, TraceRightFoorEnd, DetectionQueryParams, TraceRightFoorHitResult, bDrawDebug, FColor::Red, FColor::Green);
 
 			if(TraceRightFoorHitResult.bBlockingHit)
 			{
@@ -5011,15 +5595,16 @@ bool UClimbComponent::BalanceEndDectionUp(FVector& Location, FVector& Normal)
 
 bool UClimbComponent::BalanceEndDectionDown(FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterBackwardFoot = GetFootLocation() + CharacterRadius* -CharacterForwardVector;
 
 	FVector TraceStart = CharacterBackwardFoot + FVector::UpVector * 30;
 	FVector TraceEnd = TraceStart + FVector::DownVector * 60;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.Location;
@@ -5035,7 +5620,8 @@ bool UClimbComponent::BalanceEndDectionDown(FVector& Location, FVector& Normal)
 
 		//TraceLeftFoor
 		FVector TraceLeftFoorEnd = FloorTraceStart + CharacterRightVector * -CharacterRadius * 0.5;
-		FHitResult TraceLeftFoorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FloorTraceStart, TraceLeftFoorEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+		FHitResult TraceLeftFoorHitResult;
+		UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FloorTraceStart, TraceLeftFoorEnd, DetectionQueryParams, TraceLeftFoorHitResult, bDrawDebug, FColor::Red, FColor::Green);
 
 		if (TraceLeftFoorHitResult.bBlockingHit)
 		{
@@ -5045,7 +5631,8 @@ bool UClimbComponent::BalanceEndDectionDown(FVector& Location, FVector& Normal)
 		{
 			//TraceRightFoor
 			FVector TraceRightFoorEnd = FloorTraceStart + CharacterRightVector * CharacterRadius * 0.5;
-			FHitResult TraceRightFoorHitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, FloorTraceStart, TraceRightFoorEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+			FHitResult TraceRightFoorHitResult;
+			UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), FloorTraceStart, TraceRightFoorEnd, DetectionQueryParams, TraceRightFoorHitResult, bDrawDebug, FColor::Red, FColor::Green);
 
 			if (TraceRightFoorHitResult.bBlockingHit)
 			{
@@ -5063,10 +5650,10 @@ bool UClimbComponent::BalanceEndDectionDown(FVector& Location, FVector& Normal)
 
 bool UClimbComponent::NarrowSpaceEndDectionUp(FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector TraceStart = CharacterLocation +
 						 CharacterForwardVector * CharacterRadius;
@@ -5074,7 +5661,8 @@ bool UClimbComponent::NarrowSpaceEndDectionUp(FVector& Location, FVector& Normal
 	FVector TraceEnd = TraceStart +
 					   CharacterRightVector * ( CharacterRadius + 5 );
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -5086,10 +5674,10 @@ bool UClimbComponent::NarrowSpaceEndDectionUp(FVector& Location, FVector& Normal
 
 bool UClimbComponent::NarrowSpaceEndDectionDown(FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
+	FVector CharacterLocation = GetFrameContext().Location;
 
 	FVector TraceStart = CharacterLocation +
 						 -CharacterForwardVector * CharacterRadius;
@@ -5097,7 +5685,8 @@ bool UClimbComponent::NarrowSpaceEndDectionDown(FVector& Location, FVector& Norm
 	FVector TraceEnd = TraceStart +
 					   CharacterRightVector * (CharacterRadius + 5);
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -5109,11 +5698,11 @@ bool UClimbComponent::NarrowSpaceEndDectionDown(FVector& Location, FVector& Norm
 
 bool UClimbComponent::LedgeWalkEndDectionUp(bool IsRightWalk, FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterFootLocation = GetFootLocation();
 
 	FVector TraceStart = CharacterFootLocation +
@@ -5124,7 +5713,8 @@ bool UClimbComponent::LedgeWalkEndDectionUp(bool IsRightWalk, FVector& Location,
 	FVector TraceEnd = TraceStart +
 					   CharacterUpVector * -60;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -5136,11 +5726,11 @@ bool UClimbComponent::LedgeWalkEndDectionUp(bool IsRightWalk, FVector& Location,
 
 bool UClimbComponent::LedgeWalkEndDectionDown(bool IsRightWalk, FVector& Location, FVector& Normal)
 {
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
-	FVector CharacterUpVector = OwnerCharacter->GetActorUpVector();
-	FVector CharacterRightVector = OwnerCharacter->GetActorRightVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
+	FVector CharacterUpVector = GetFrameContext().UpVector;
+	FVector CharacterRightVector = GetFrameContext().RightVector;
 	FVector TraceVector = IsRightWalk ? CharacterRightVector : -CharacterRightVector;
-	float CharacterRadius = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float CharacterRadius = GetFrameContext().CapsuleRadius;
 	FVector CharacterFootLocation = GetFootLocation();
 
 	FVector TraceStart = CharacterFootLocation +
@@ -5151,7 +5741,8 @@ bool UClimbComponent::LedgeWalkEndDectionDown(bool IsRightWalk, FVector& Locatio
 	FVector TraceEnd = TraceStart +
 					   CharacterUpVector * -60;
 
-	FHitResult HitResult = UTraceBlueprintFunctionLibrary::LineTrace(OwnerCharacter, TraceStart, TraceEnd, TArray<AActor*>(), bDrawDebug, FColor::Red, FColor::Green);
+	FHitResult HitResult;
+	UTraceBlueprintFunctionLibrary::LineTrace(GetWorld(), TraceStart, TraceEnd, DetectionQueryParams, HitResult, bDrawDebug, FColor::Red, FColor::Green);
 	if (HitResult.bBlockingHit)
 	{
 		Location = HitResult.ImpactPoint;
@@ -5168,7 +5759,373 @@ bool UClimbComponent::FindMontagePlayInofoByClimbAction(UClimbAction ClimbAction
 		return false;
 	}
 
-	return ClimbMontageAnimConfig->GetMontagePlayInofoByClimbAction(ClimbAction , outMontagePlayInofo);
+	const FMontagePlayInofo* MontagePlayInofo = ClimbMontageAnimConfig->GetMontagePlayInofoByClimbAction(ClimbAction, MontageRandomStream);
+	if (MontagePlayInofo == nullptr)
+	{
+		return false;
+	}
+
+	//The action was triggered before its montage finished streaming in
+	if (MontagePlayInofo->AnimMontageToPlay.IsPending())
+	{
+		UE_LOG(LogClimbComponent, Verbose, TEXT("Loading %s synchronously, it was not streamed in for climb state %d"), *MontagePlayInofo->AnimMontageToPlay.ToString(), (int32)ClimbState);
+		MontagePlayInofo->AnimMontageToPlay.LoadSynchronous();
+	}
+
+	outMontagePlayInofo = *MontagePlayInofo;
+	return true;
+}
+
+float UClimbComponent::PlayClimbMontage(const FMontagePlayInofo& MontagePlayInofo)
+{
+	float PlayLength = ClimbingAnimInstance->Montage_Play(MontagePlayInofo.AnimMontageToPlay.Get());
+
+	if (PlayLength > 0)
+	{
+		Telemetry.Current.MontageTriggers++;
+		CSV_CUSTOM_STAT(Climbing, MontageTriggers, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	return PlayLength;
+}
+
+void UClimbComponent::UpdateMontageStreaming()
+{
+	StreamedClimbState = ClimbState;
+
+	if (ClimbMontageAnimConfig == nullptr)
+		return;
+
+	TArray<FSoftObjectPath> Montages;
+
+	//Entries into every state start from the default one, keep its set loaded whatever the state
+	if (!DefaultMontageStreamingHandle.IsValid())
+	{
+		ClimbMontageAnimConfig->GetClimbActionMontages(UClimbMontageAnimConfig::GetClimbStateActions(UClimbState::Default), Montages);
+
+		if (Montages.Num() > 0)
+		{
+			DefaultMontageStreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Montages, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		}
+
+		Montages.Reset();
+	}
+
+	//The state's set with the exits of the states reachable from it, so those are loaded before the transition into them
+	ClimbMontageAnimConfig->GetClimbStateMontages(ClimbState, Montages);
+
+	//Hold the old set until the new one has loaded, a montage of the state just left can still be asked for while it streams
+	OnMontageStreamingLoaded();
+	PreviousMontageStreamingHandle = MontageStreamingHandle;
+	MontageStreamingHandle.Reset();
+
+	if (Montages.Num() > 0)
+	{
+		MontageStreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Montages, FStreamableDelegate::CreateUObject(this, &UClimbComponent::OnMontageStreamingLoaded), FStreamableManager::AsyncLoadHighPriority);
+	}
+
+	if (!MontageStreamingHandle.IsValid())
+	{
+		OnMontageStreamingLoaded();
+	}
+}
+
+void UClimbComponent::OnMontageStreamingLoaded()
+{
+	if (PreviousMontageStreamingHandle.IsValid())
+	{
+		PreviousMontageStreamingHandle->ReleaseHandle();
+		PreviousMontageStreamingHandle.Reset();
+	}
+}
+
+void UClimbComponent::CacheAnimInstanceBinding()
+{
+	ClimbCharacterAnimInstance = Cast<UClimbCharacterAnimInstance>(ClimbingAnimInstance);
+
+	AnimDirectionEvent = nullptr;
+	AnimInputEvent = nullptr;
+	AnimChangeClimbPostureEvent = nullptr;
+
+	if (ClimbingAnimInstance == nullptr || !ClimbingAnimInstance->GetClass()->ImplementsInterface(UIAnimInt::StaticClass()))
+		return;
+
+	auto FindAnimEvent = [this](FName EventName) -> UFunction*
+	{
+		UFunction* Event = ClimbingAnimInstance->FindFunction(EventName);
+
+		//UClimbCharacterAnimInstance reads ClimbAnimData instead, only Blueprint overrides still need the event
+		if (Event != nullptr && Event->HasAnyFunctionFlags(FUNC_Native) && ClimbCharacterAnimInstance != nullptr)
+			return nullptr;
+
+		return Event;
+	};
+
+	AnimDirectionEvent = FindAnimEvent(GET_FUNCTION_NAME_CHECKED(IIAnimInt, INT_Direction));
+	AnimInputEvent = FindAnimEvent(GET_FUNCTION_NAME_CHECKED(IIAnimInt, INT_Input));
+	AnimChangeClimbPostureEvent = FindAnimEvent(GET_FUNCTION_NAME_CHECKED(IIAnimInt, INT_ChangeClimbPosture));
+}
+
+void UClimbComponent::UpdateAnimDirection(float Direction)
+{
+	if (ClimbCharacterAnimInstance != nullptr)
+		ClimbCharacterAnimInstance->PendingClimbAnimData.Direction = Direction;
+
+	if (AnimDirectionEvent != nullptr)
+	{
+		//Same layout as the generated parameters of IIAnimInt::INT_Direction
+		struct { float Direction; } Parms = { Direction };
+		ClimbingAnimInstance->ProcessEvent(AnimDirectionEvent, &Parms);
+	}
+}
+
+void UClimbComponent::UpdateAnimInput(const FVector2D& Input)
+{
+	if (ClimbCharacterAnimInstance != nullptr)
+		ClimbCharacterAnimInstance->PendingClimbAnimData.Input = Input;
+
+	if (AnimInputEvent != nullptr)
+	{
+		struct { FVector2D Input; } Parms = { Input };
+		ClimbingAnimInstance->ProcessEvent(AnimInputEvent, &Parms);
+	}
+}
+
+void UClimbComponent::UpdateAnimClimbPosture(UClimbState State)
+{
+	if (ClimbCharacterAnimInstance != nullptr)
+		ClimbCharacterAnimInstance->PendingClimbAnimData.ClimbState = State;
+
+	if (AnimChangeClimbPostureEvent != nullptr)
+	{
+		struct { UClimbState State; } Parms = { State };
+		ClimbingAnimInstance->ProcessEvent(AnimChangeClimbPostureEvent, &Parms);
+	}
+}
+
+void UClimbComponent::UpdateAnimLedge()
+{
+	if (ClimbCharacterAnimInstance == nullptr)
+		return;
+
+	ClimbCharacterAnimInstance->PendingClimbAnimData.LedgeNormal = ObstacleNormalDir;
+	ClimbCharacterAnimInstance->PendingClimbAnimData.LedgeLocation = ObstacleLocation;
+}
+
+void UClimbComponent::RecordTickTelemetry(float DeltaTime)
+{
+	if (ClimbState != LastTelemetryState)
+	{
+		Telemetry.RecordTransition();
+		LastTelemetryState = ClimbState;
+
+		CSV_CUSTOM_STAT(Climbing, StateTransitions, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	CSV_CUSTOM_STAT(Climbing, LineTraces, (int32)Telemetry.TickTraces[(int32)ETraceShape::Line], ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Climbing, SphereTraces, (int32)Telemetry.TickTraces[(int32)ETraceShape::Sphere], ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Climbing, BoxTraces, (int32)Telemetry.TickTraces[(int32)ETraceShape::Box], ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Climbing, CapsuleTraces, (int32)Telemetry.TickTraces[(int32)ETraceShape::Capsule], ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Climbing, TraceHits, (int32)Telemetry.TickHits, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Climbing, ClimbingCharacters, ClimbState != UClimbState::Default ? 1 : 0, ECsvCustomStatOp::Accumulate);
+
+	Telemetry.EndTick(ClimbState, DeltaTime);
+}
+
+void UClimbComponent::StartInputRecording()
+{
+	if (OwnerCharacter == nullptr)
+		return;
+
+	StopInputReplay();
+
+	InputRecording = FClimbInputRecording();
+	InputRecording.StartLocation = GetFrameContext().Location;
+	InputRecording.StartRotation = GetFrameContext().Rotation;
+	InputRecording.StartVelocity = ClimbingMovementComponent->Velocity;
+	InputRecording.StartClimbState = (uint8)ClimbState;
+	InputRecording.StartObstacleLocation = ObstacleLocation;
+	InputRecording.StartObstacleNormal = ObstacleNormalDir;
+	InputRecording.StartFloorLocation = FloorLocation;
+	InputRecording.StartFloorNormal = FloorNormalDir;
+
+	//From here on montage variations come from the recorded seed
+	InputRecording.RandomSeed = FMath::Rand();
+	MontageRandomStream.Initialize(InputRecording.RandomSeed);
+
+	PendingCrouchFlags = 0;
+	bRecordingInput = true;
+
+	if (ClimbingAnimInstance != nullptr && ClimbingAnimInstance->IsAnyMontagePlaying())
+	{
+		UE_LOG(LogClimbComponent, Warning, TEXT("%s: recording climb input while a montage plays, the replay starts without it"), *GetNameSafe(OwnerCharacter));
+	}
+
+	UE_LOG(LogClimbComponent, Display, TEXT("%s: recording climb input"), *GetNameSafe(OwnerCharacter));
+}
+
+bool UClimbComponent::StopInputRecording(const FString& Path)
+{
+	if (!bRecordingInput)
+		return false;
+
+	bRecordingInput = false;
+
+	if (!InputRecording.SaveToFile(Path))
+		return false;
+
+	UE_LOG(LogClimbComponent, Display, TEXT("%s: saved %d frames of climb input to %s"), *GetNameSafe(OwnerCharacter), InputRecording.Frames.Num(), *Path);
+	return true;
+}
+
+bool UClimbComponent::StartInputReplay(const FString& Path)
+{
+	if (OwnerCharacter == nullptr)
+		return false;
+
+	bRecordingInput = false;
+	StopInputReplay();
+
+	//A montage in flight would keep moving the character and change its state under the replay
+	if (ClimbingAnimInstance != nullptr && ClimbingAnimInstance->IsAnyMontagePlaying())
+	{
+		UE_LOG(LogClimbComponent, Warning, TEXT("%s: cannot replay climb input while a montage plays"), *GetNameSafe(OwnerCharacter));
+		return false;
+	}
+
+	if (!InputRecording.LoadFromFile(Path) || InputRecording.Frames.Num() == 0)
+		return false;
+
+	OwnerCharacter->SetActorLocationAndRotation(InputRecording.StartLocation, InputRecording.StartRotation, false, nullptr, ETeleportType::ResetPhysics);
+	RefreshFrameContext();
+
+	if (!RestoreReplayClimbState())
+	{
+		UE_LOG(LogClimbComponent, Warning, TEXT("%s: %s was recorded in climb state %d, which cannot be restored"), *GetNameSafe(OwnerCharacter), *Path, (int32)InputRecording.StartClimbState);
+		return false;
+	}
+
+	ClimbingMovementComponent->Velocity = InputRecording.StartVelocity;
+	MontageRandomStream.Initialize(InputRecording.RandomSeed);
+
+	//Every following frame runs with the delta time it was recorded with
+	bReplayRestoreFixedTimeStep = FApp::UseFixedTimeStep();
+	ReplayRestoreFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(InputRecording.Frames[0].DeltaTime);
+
+	ReplayFrameIndex = 0;
+	ReplayStartFrame = GFrameCounter + 1;
+
+	UE_LOG(LogClimbComponent, Display, TEXT("%s: replaying %d frames of climb input from %s"), *GetNameSafe(OwnerCharacter), InputRecording.Frames.Num(), *Path);
+	return true;
+}
+
+void UClimbComponent::StopInputReplay()
+{
+	if (!IsReplayingInput())
+		return;
+
+	ReplayFrameIndex = INDEX_NONE;
+
+	FApp::SetUseFixedTimeStep(bReplayRestoreFixedTimeStep);
+	FApp::SetFixedDeltaTime(ReplayRestoreFixedDeltaTime);
+}
+
+void UClimbComponent::RecordInputFrame(float DeltaTime)
+{
+	FClimbInputFrame& Frame = InputRecording.Frames.AddDefaulted_GetRef();
+	Frame.DeltaTime = DeltaTime;
+	Frame.MovementInput = FVector2f(MovementInput);
+
+	FRotator ControlRotation = OwnerCharacter->GetControlRotation();
+	Frame.ControlPitch = ControlRotation.Pitch;
+	Frame.ControlYaw = ControlRotation.Yaw;
+
+	Frame.JumpState = (uint8)JumpState;
+	Frame.Flags = PendingCrouchFlags;
+	PendingCrouchFlags = 0;
+}
+
+void UClimbComponent::ApplyReplayFrame()
+{
+	if (GFrameCounter < ReplayStartFrame)
+	{
+		//Hold still until the recorded delta times kick in
+		MovementInput = FVector2D::ZeroVector;
+		JumpState = UJumpState::Idle;
+		return;
+	}
+
+	const FClimbInputFrame& Frame = InputRecording.Frames[ReplayFrameIndex];
+
+	if (AController* Controller = OwnerCharacter->GetController())
+	{
+		Controller->SetControlRotation(FRotator(Frame.ControlPitch, Frame.ControlYaw, 0));
+	}
+
+	MovementInput = FVector2D(Frame.MovementInput);
+	JumpState = (UJumpState)Frame.JumpState;
+
+	bApplyingReplayFrame = true;
+	if (Frame.Flags & FClimbInputFrame::CrouchPressed)
+		CrouchPressed();
+	if (Frame.Flags & FClimbInputFrame::CrouchReleased)
+		CrouchReleased();
+	bApplyingReplayFrame = false;
+
+	ReplayFrameIndex++;
+	if (ReplayFrameIndex < InputRecording.Frames.Num())
+	{
+		FApp::SetFixedDeltaTime(InputRecording.Frames[ReplayFrameIndex].DeltaTime);
+		return;
+	}
+
+	StopInputReplay();
+
+	UE_LOG(LogClimbComponent, Display, TEXT("%s: climb input replay finished, %s"), *GetNameSafe(OwnerCharacter), *Telemetry.ToString());
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("ClimbReplayExit")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+bool UClimbComponent::RestoreReplayClimbState()
+{
+	ObstacleLocation = InputRecording.StartObstacleLocation;
+	ObstacleNormalDir = InputRecording.StartObstacleNormal;
+	FloorLocation = InputRecording.StartFloorLocation;
+	FloorNormalDir = InputRecording.StartFloorNormal;
+
+	switch ((UClimbState)InputRecording.StartClimbState)
+	{
+		case UClimbState::Default:
+			SetUpDefaultState();
+			return true;
+		case UClimbState::Climbing:
+			SetUpClimbingState();
+			return true;
+		case UClimbState::ClimbingPipe:
+			SetUpClimbingPipeState();
+			return true;
+		case UClimbState::Hanging:
+			SetUpHangingState();
+			return true;
+		case UClimbState::Balance:
+			SetUpBalanceState();
+			return true;
+		case UClimbState::NarrowSpace:
+			SetUpNarrowSpaceState();
+			return true;
+		case UClimbState::LedgeWalkRight:
+		case UClimbState::LedgeWalkLeft:
+			SetUpLedgeWalkState((UClimbState)InputRecording.StartClimbState == UClimbState::LedgeWalkRight);
+			return true;
+		default:
+			//Zip lines are ridden along the actor they were entered from
+			return false;
+	}
 }
 
 void UClimbComponent::HangingRemapInputVector()
@@ -5181,7 +6138,7 @@ void UClimbComponent::HangingRemapInputVector()
 
 	FRotator ControllerRotation = OwnerCharacter->GetControlRotation();
 	FVector ControllerForwardVector = ControllerRotation.Quaternion().GetForwardVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 
 	MovementInput.X = (FVector::DotProduct(ControllerForwardVector, CharacterForwardVector) >= 0) ? MovementInput.X : -MovementInput.X;
 }
@@ -5196,7 +6153,7 @@ void UClimbComponent::BalanceRemapInputVector()
 
 	FRotator ControllerRotation = OwnerCharacter->GetControlRotation();
 	FVector ControllerForwardVector = ControllerRotation.Quaternion().GetForwardVector();
-	FVector CharacterForwardVector = OwnerCharacter->GetActorForwardVector();
+	FVector CharacterForwardVector = GetFrameContext().ForwardVector;
 
 	MovementInput.Y = (FVector::DotProduct(ControllerForwardVector, CharacterForwardVector) >= 0) ? MovementInput.Y : -MovementInput.Y;
 }
@@ -11,6 +11,10 @@
 #include "Animation/AnimInstance.h"
 #include "MotionWarpingComponent.h"
 #include "ClimbMontageAnimConfig.h"
+#include "TraceBlueprintFunctionLibrary.h"
+#include "ClimbTelemetry.h"
+#include "ClimbInputRecording.h"
+#include "ClimbProbeSet.h"
 #include "ClimbComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -21,12 +25,68 @@ enum class UJumpState : uint8
 	Release
 };
 
+/** How often a climb state runs its detection pass. */
+USTRUCT(BlueprintType)
+struct FClimbDetectionRate
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Seconds between detection passes while the character moves or has input, 0 runs every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MovingInterval = 0;
+
+	/** Seconds between detection passes while the character stands still without input. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float IdleInterval = 0;
+
+	/** Seconds between detection passes once nobody is looking at the character, blended in by significance. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float InsignificantInterval = 0;
+};
+
+/** Owner transform and capsule size, read once per tick instead of once per check. */
+struct FClimbFrameContext
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector ForwardVector = FVector::ForwardVector;
+	FVector RightVector = FVector::RightVector;
+	FVector UpVector = FVector::UpVector;
+
+	float CapsuleRadius = 0;
+	float CapsuleHalfHeight = 0;
+};
+
+/** The probe of a mirrored climb check that was accepted, with the montage of its action. */
+struct FClimbProbeResult
+{
+	FHitResult Hit;
+	UClimbAction Action;
+	FMontagePlayInofo MontagePlayInofo;
+};
+
+/** Default state probes that can be issued ahead of time through the world's async trace queue. */
+enum class EClimbAsyncProbe : uint8
+{
+	Obstacle,
+	HangingObstacle,
+	ZipLine,
+	FloorLeft,
+	FloorRight,
+	NarrowSpaceLeft,
+	NarrowSpaceRight,
+	Num
+};
+
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class CLIMBINGSYSTEM_API UClimbComponent : public UActorComponent, public IIZipSystem
 {
 	GENERATED_BODY()
 
+	friend class UClimbProbeSubsystem;
+
 public:	
 	// Sets default values for this component's properties
 	UClimbComponent();
@@ -35,6 +95,8 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Called for movement input */
 	void Move(const FInputActionValue& Value);
 
@@ -69,14 +131,100 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Debug)
 	bool bDrawDebug;
 
+	/** Issue the default state probes through the async trace queue and consume them one frame later. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	bool bAsyncDetection = false;
+
+	/** Throttle the detection pass by DetectionRates and the significance of the character. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	bool bUseDetectionScheduler = true;
+
+	/** Detection rate per climb state, states without an entry run detection every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	TMap<UClimbState, FClimbDetectionRate> DetectionRates;
+
+	/** Distance to the closest viewer at which a character becomes fully insignificant. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	float SignificanceDistance = 5000;
+
+	/** Find hanging ledges in the level's baked climb feature index first, tracing only for ledges it does not contain. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	bool bUseClimbFeatureIndex = false;
+
+	/** Baked index to query, loaded from the level's bake path when left empty. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	class UClimbFeatureIndex* ClimbFeatureIndex = nullptr;
+
+	/** Share hang targets and balance beam extents found by detection with every character through the world's feature cache. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	bool bUseClimbFeatureCache = false;
+
+	/** Traces one detection pass costs, weighed against Clamb.DetectionTraceBudget. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	int32 EstimatedDetectionTraces = 24;
+
+	/** Probe descriptors of the mirrored side jump and corner checks, the built in defaults when empty. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Detection)
+	UClimbProbeSet* ClimbProbeSet = nullptr;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = AnimConfig, meta = (AllowPrivateAccess = "true"))
 	UClimbMontageAnimConfig* ClimbMontageAnimConfig;
 
+	/** Let AClimbCustomCameraManager read the camera parameters below natively instead of calling the pawn's camera interface events. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	bool bProvideCameraParameters = false;
+
+	/** Socket of the owner's mesh the camera pivots on, oriented like the actor. The actor itself when None or missing. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	FName CameraPivotSocket;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	float CameraFOV = 90;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	bool bCameraRightShoulder = true;
+
 	UFUNCTION(BlueprintCallable)
 	UClimbState GetClimbState();
 
+	/** Continues a Climbing or Hanging state simulated elsewhere, used when a Mass crowd climber is promoted to this character. */
+	void ResumeClimb(UClimbState State, const FVector& InObstacleLocation, const FVector& InObstacleNormalDir);
+
+	/** Whether the character can be demoted back to a Mass crowd climber, which only picks up from walking in the default state. */
+	bool CanHandOffToCrowd() const;
+
+	/** Hands world space IK targets to a UClimbCharacterAnimInstance, for its worker thread update. */
+	UFUNCTION(BlueprintCallable)
+	void SetClimbIKTargets(FVector LeftHand, FVector RightHand, FVector LeftFoot, FVector RightFoot);
+
+	/** The camera interface parameters of the owner, from CameraPivotSocket, CameraFOV and bCameraRightShoulder. */
+	void GetCameraParameters(FTransform& OutPivotTarget, float& OutFOV, bool& OutRightShoulder) const;
+
 	void INT_FinishZiplineGliding_Implementation();
 
+	/** Feeds input without the enhanced input bindings, for benchmarks and replays. Movement input only lasts one tick. */
+	void SetScriptedMoveInput(FVector2D Input);
+	void SetScriptedJump(bool bPressed);
+
+	const FClimbTelemetry& GetTelemetry() const { return Telemetry; }
+
+	/** Records the input consumed on every tick until StopInputRecording. */
+	void StartInputRecording();
+	bool StopInputRecording(const FString& Path);
+
+	/**
+	 * Replays a recording with its delta times as a fixed time step, ignoring live input until it ends.
+	 * The recorded climb state, velocity and montage seed are restored first. Fails while a montage plays.
+	 */
+	bool StartInputReplay(const FString& Path);
+	void StopInputReplay();
+
+	/** Call after resizing or rescaling the owner's capsule outside of crouching. */
+	void MarkCapsuleDirty() { bCapsuleDirty = true; }
+
+	bool IsRecordingInput() const { return bRecordingInput; }
+	bool IsReplayingInput() const { return ReplayFrameIndex != INDEX_NONE; }
+
 private:
 	void HandleJumpInput(float DeltaTime);
 	void HandleDefaultMoveInput();
@@ -136,8 +284,29 @@ private:
 	void DefaultFloorCheck(float DeltaTime);
 	void DefaultNarrowSpaceCheck(float DeltaTime);
 
+	FTraceRequest MakeObstacleDetectionDefaultRequest(float MinDistance, float MaxDistance, const FVector& Velocity) const;
+	FTraceRequest MakeHangingObstacleDetectionDefaultRequest(float MinDistance, float MaxDistance, const FVector& Velocity) const;
+	FTraceRequest MakeZipLineDetectionRequest() const;
+	void MakeDefaultFloorTraceRequests(TArrayView<FTraceRequest> OutRequests) const;
+	void MakeDefaultNarrowSpaceTraceRequests(TArrayView<FTraceRequest> OutRequests) const;
+
+	bool ShouldRunDetection(float DeltaTime);
+	float GetDetectionInterval() const;
+	float CalculateSignificance(const FTransform& Viewpoint) const;
+
+	void IssueAsyncDetectionProbes(float DeltaTime);
+	/** Hands the default state probes to UClimbProbeSubsystem, which issues them together with those of the other climbers. */
+	void QueueBatchedDetectionProbes();
+	void IssueAsyncDetectionProbe(EClimbAsyncProbe Probe, const FTraceRequest& Request, const FCollisionQueryParams& QueryParams);
+	/** Whether zip lines are found in UClimbZipLineSubsystem instead of by the zip line sweep. */
+	bool UsesZipLineIndex() const;
+	void OnAsyncDetectionTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	bool GetAsyncDetectionResult(EClimbAsyncProbe Probe, FHitResult& OutHitResult);
+	bool GetAsyncDetectionResults(EClimbAsyncProbe FirstProbe, TArrayView<FTraceHitRecord> OutHitRecords);
+
 	bool ClimbRightJumpCheck();
 	bool ClimbLeftJumpCheck();
+	bool ClimbSideJumpCheck(bool bLeft);
 	bool ClimbDownJumpCheck();
 	bool ClimbUpJumpCheck();
 
@@ -151,6 +320,14 @@ private:
 	bool HangingRightCornerOuterCheck();
 	bool HangingLeftCornerOuterCheck();
 
+	/** Shared bodies of the right and left variants above, bLeft mirrors their probes. */
+	bool ClimbCornerInnerCheck(bool bLeft);
+	bool ClimbCornerOuterCheck(bool bLeft);
+	bool HangingCornerCheck(EClimbProbeGroup Group, bool bLeft);
+
+	/** Runs the probes of Group in order and returns the first one that is accepted and has a montage. */
+	bool EvaluateProbes(EClimbProbeGroup Group, bool bMirrored, FClimbProbeResult& OutResult);
+
 	bool ClimbUpActionCheck();
 	bool ClimbLandingCheck();
 	bool ClimbingToHangingCheck();
@@ -181,6 +358,11 @@ private:
 	FVector GetFootLocation() const;
 	FVector GetTopLocation() const;
 
+	/** The owner's frame context, cached for the duration of TickComponent and rebuilt on every call outside of it. */
+	const FClimbFrameContext& GetFrameContext() const;
+	/** Rereads the owner transform, call after moving the owner during the tick. */
+	void RefreshFrameContext() const;
+
 	void FindClimbingRotationUp();
 	void FindClimbingRotationRight();
 	void FindClimbingRotationLeft();
@@ -228,6 +410,28 @@ private:
 
 	bool FindMontagePlayInofoByClimbAction(UClimbAction ClimbAction, FMontagePlayInofo& outMontagePlayInofo);
 
+	/** Plays the montage on ClimbingAnimInstance, counting it as a montage trigger when it started. */
+	float PlayClimbMontage(const FMontagePlayInofo& MontagePlayInofo);
+
+	/** Streams in the montages of the current climb state and the exits of the states reachable from it, releasing the previous set once they are loaded. */
+	void UpdateMontageStreaming();
+	void OnMontageStreamingLoaded();
+
+	/** Resolves how climb data reaches ClimbingAnimInstance, call whenever it is assigned. */
+	void CacheAnimInstanceBinding();
+
+	void UpdateAnimDirection(float Direction);
+	void UpdateAnimInput(const FVector2D& Input);
+	void UpdateAnimClimbPosture(UClimbState State);
+	void UpdateAnimLedge();
+
+	void RecordTickTelemetry(float DeltaTime);
+
+	void RecordInputFrame(float DeltaTime);
+	void ApplyReplayFrame();
+	/** Sets up the climb state a recording started in, false for states that cannot be entered without their actor. */
+	bool RestoreReplayClimbState();
+
 	void HangingRemapInputVector();
 	void BalanceRemapInputVector();
 
@@ -236,7 +440,21 @@ private:
 	bool bComponentInitalize = false;
 
 	ACharacter* OwnerCharacter;
+
+	mutable FClimbFrameContext FrameContext;
+	bool bFrameContextValid = false;
+	mutable bool bCapsuleDirty = true;
+	mutable bool bCapsuleCrouched = false;
+	mutable FVector CapsuleScale = FVector::OneVector;
+
 	UAnimInstance* ClimbingAnimInstance;
+	class UClimbCharacterAnimInstance* ClimbCharacterAnimInstance = nullptr;
+
+	/** IIAnimInt events of ClimbingAnimInstance, looked up once in CacheAnimInstanceBinding. */
+	UFunction* AnimDirectionEvent = nullptr;
+	UFunction* AnimInputEvent = nullptr;
+	UFunction* AnimChangeClimbPostureEvent = nullptr;
+
 	UInputComponent* ClimbingInputComponent;
 	UCharacterMovementComponent* ClimbingMovementComponent;
 	UMotionWarpingComponent* MotionWarpingComponent;
@@ -262,4 +480,47 @@ private:
 
 	AActor* ZipLineObj;
 	float ZipLineTraceIntervalTime;
+
+	float DetectionSignificance = 1;
+	float DetectionElapsedTime = 0;
+	float DetectionDeltaTime = 0;
+	UClimbState LastDetectionState = UClimbState::Default;
+
+	/** Built once in BeginPlay and shared by every detection trace. */
+	FCollisionQueryParams DetectionQueryParams;
+	FCollisionQueryParams DetectionIgnoreOwnerQueryParams;
+
+	FTraceDelegate AsyncDetectionTraceDelegate;
+	FTraceHandle AsyncDetectionTraceHandles[(int32)EClimbAsyncProbe::Num];
+	FHitResult AsyncDetectionHitResults[(int32)EClimbAsyncProbe::Num];
+	bool bAsyncDetectionHitValid[(int32)EClimbAsyncProbe::Num] = {};
+
+	class UClimbFeatureCacheSubsystem* ClimbFeatureCache = nullptr;
+	class UClimbTraceBudgetSubsystem* TraceBudget = nullptr;
+	class UClimbProbeSubsystem* ProbeSubsystem = nullptr;
+	class UClimbZipLineSubsystem* ZipLineSubsystem = nullptr;
+
+	FClimbTelemetry Telemetry;
+	UClimbState LastTelemetryState = UClimbState::Default;
+
+	FClimbInputRecording InputRecording;
+	bool bRecordingInput = false;
+	/** Picks montage variations, seeded by recordings so replays pick the same ones. */
+	FRandomStream MontageRandomStream;
+	/** Crouch events since the last recorded frame, as FClimbInputFrame::EFlags. */
+	uint8 PendingCrouchFlags = 0;
+
+	int32 ReplayFrameIndex = INDEX_NONE;
+	/** Replay starts on the frame after StartInputReplay, the first one that runs with a recorded delta time. */
+	uint64 ReplayStartFrame = 0;
+	bool bApplyingReplayFrame = false;
+	bool bReplayRestoreFixedTimeStep = false;
+	double ReplayRestoreFixedDeltaTime = 0;
+
+	/** The default state's montages, which hold the entries into every other state, kept for the component's lifetime. */
+	TSharedPtr<struct FStreamableHandle> DefaultMontageStreamingHandle;
+	TSharedPtr<struct FStreamableHandle> MontageStreamingHandle;
+	/** The set of the previous state, held until MontageStreamingHandle has loaded. */
+	TSharedPtr<struct FStreamableHandle> PreviousMontageStreamingHandle;
+	UClimbState StreamedClimbState = UClimbState::Default;
 };
@@ -6,6 +6,56 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "TraceBlueprintFunctionLibrary.h"
 #include "Engine/Private/KismetTraceUtils.h"
+#include "ClimbStats.h"
+#include "ClimbCameraMath.h"
+#include "ClimbComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbCamera, Log, All);
+
+enum class EClimbCameraCurve : uint8
+{
+	RotationLagSpeed,
+	PivotLagSpeed_X,
+	PivotLagSpeed_Y,
+	PivotLagSpeed_Z,
+	PivotOffset_X,
+	PivotOffset_Y,
+	PivotOffset_Z,
+	CameraOffset_X,
+	CameraOffset_Y,
+	CameraOffset_Z,
+	Override_Debug,
+	Num
+};
+
+//Same layouts as the generated parameters of the IClimbCustomCameraInterface events, checked against their ParmsSize when binding
+struct FClimbPawnSupportCameraParms
+{
+	bool IsSupportClimbCustomCamera;
+};
+
+struct FClimbPawnCameraParametersParms
+{
+	FTransform PivotTarget;
+	float FOV;
+	bool RightShoulder;
+};
+
+//Names are made once instead of hashing the string literals on every lookup, indexed by EClimbCameraCurve
+static const FName ClimbCameraCurveNames[(int32)EClimbCameraCurve::Num] =
+{
+	TEXT("RotationLagSpeed"),
+	TEXT("PivotLagSpeed_X"),
+	TEXT("PivotLagSpeed_Y"),
+	TEXT("PivotLagSpeed_Z"),
+	TEXT("PivotOffset_X"),
+	TEXT("PivotOffset_Y"),
+	TEXT("PivotOffset_Z"),
+	TEXT("CameraOffset_X"),
+	TEXT("CameraOffset_Y"),
+	TEXT("CameraOffset_Z"),
+	TEXT("Override_Debug")
+};
 
 AClimbCustomCameraManager::AClimbCustomCameraManager()
 {
@@ -17,6 +67,10 @@ AClimbCustomCameraManager::AClimbCustomCameraManager()
 void AClimbCustomCameraManager::BeginPlay()
 {
 	Super::BeginPlay();
+
+	CameraProbeDelegate.BindUObject(this, &AClimbCustomCameraManager::OnCameraProbeDone);
+
+	bBlueprintUpdateCameraImplemented = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AClimbCustomCameraManager, BlueprintUpdateCamera));
 	
 	if (CameraAnimInstace == nullptr)
 	{
@@ -41,6 +95,15 @@ void AClimbCustomCameraManager::INT_OnPossess_Implementation(APawn* ControlledPa
 	{
 		ControlPawn = ControlledPawn;
 
+		CameraProbeQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(ClimbCameraProbe), false);
+		CameraProbeQueryParams.AddIgnoredActor(ControlPawn);
+		CameraProbeQueryParams.AddIgnoredActor(this);
+		CameraBlocker.Reset();
+		CameraProbeSampleTime = -1;
+		SmoothedPivotVelocity = FVector::ZeroVector;
+
+		CachePawnCameraBinding();
+
 		if (CameraAnimInstace == nullptr)
 		{
 			UAnimInstance* AnimInstace = CameraMesh->GetAnimInstance();
@@ -66,7 +129,7 @@ void AClimbCustomCameraManager::UpdateViewTargetInternal(FTViewTarget& OutVT, fl
 		FRotator OutRotation;
 		float OutFOV;
 
-		if (BlueprintUpdateCamera(OutVT.Target, OutLocation, OutRotation, OutFOV))
+		if (bBlueprintUpdateCameraImplemented && BlueprintUpdateCamera(OutVT.Target, OutLocation, OutRotation, OutFOV))
 		{
 			OutVT.POV.Location = OutLocation;
 			OutVT.POV.Rotation = OutRotation;
@@ -90,27 +153,29 @@ bool AClimbCustomCameraManager::NativeUpdateCamera(AActor* CameraTarget, FVector
 	if(ControlPawn)
 	{
 		
-		bool IsSupportClimbCustomCamera = false;
-		IClimbCustomCameraInterface::Execute_INT_PawnIsSupportClimbCustomCamera(ControlPawn, IsSupportClimbCustomCamera);
+		bool IsSupportClimbCustomCamera = PawnIsSupportClimbCustomCamera();
 
 		float WorldDeltaSeconds = UGameplayStatics::GetWorldDeltaSeconds(this);
-		float DebugAlpha = GetCameraBehaviorParam("Override_Debug");
+
+		FClimbCameraBehaviorParams BehaviorParams;
+		GetCameraBehaviorParams(BehaviorParams);
+
+		float DebugAlpha = BehaviorParams.DebugAlpha;
 
 		if(IsSupportClimbCustomCamera)
 		{
 			//Step 1: Get Camera Parameters from ControlPawn the Camera Interface
-			IClimbCustomCameraInterface::Execute_INT_GetCameraParameters(ControlPawn, PivotTarget, FOV, RightShoulder);
+			GetPawnCameraParameters(PivotTarget, FOV, RightShoulder);
 			
 			//Step 2: Calculate Target Camera Rotation. Use the Control Rotation and interpolate for smooth camera rotation.
 			FRotator CurrentCameraRotation = GetCameraRotation();
 			FRotator DesiredCameraRotation = GetOwningPlayerController()->GetControlRotation();
 
-			TargetCameraRotation = FMath::RInterpTo(CurrentCameraRotation, DesiredCameraRotation,WorldDeltaSeconds, GetCameraBehaviorParam("RotationLagSpeed"));
+			TargetCameraRotation = FMath::RInterpTo(CurrentCameraRotation, DesiredCameraRotation,WorldDeltaSeconds, BehaviorParams.RotationLagSpeed);
 			TargetCameraRotation = FMath::Lerp(TargetCameraRotation, DebugViewRotation, DebugAlpha);
 
 			//Step 3: Calculate the Smoothed Pivot Target (Orange Sphere). Get the 3P Pivot Target (Green Sphere) and interpolate using axis independent lag for maximum control.
-			FVector LagSpeeds = FVector( GetCameraBehaviorParam("PivotLagSpeed_X"), GetCameraBehaviorParam("PivotLagSpeed_Y"), GetCameraBehaviorParam("PivotLagSpeed_Z"));
-			FVector SmoothedPivotTargetLocation = CalculateAxisIndependentLag( SmoothedPivotTarget.GetLocation(), PivotTarget.GetLocation(), TargetCameraRotation, LagSpeeds);
+			FVector SmoothedPivotTargetLocation = CalculateAxisIndependentLag( SmoothedPivotTarget.GetLocation(), PivotTarget.GetLocation(), TargetCameraRotation, BehaviorParams.PivotLagSpeed, WorldDeltaSeconds);
 			SmoothedPivotTarget = FTransform(PivotTarget.Rotator(), SmoothedPivotTargetLocation);
 
 			//Step 4: Calculate Pivot Location (BlueSphere). Get the Smoothed Pivot Target and apply local offsets for further camera control.
@@ -118,9 +183,9 @@ bool AClimbCustomCameraManager::NativeUpdateCamera(AActor* CameraTarget, FVector
 			FVector SmoothedPivotTargeRightVector = SmoothedPivotTarget.GetRotation().GetRightVector();
 			FVector SmoothedPivotTargeUpVector = SmoothedPivotTarget.GetRotation().GetUpVector();
 
-			FVector PivotOffsetForward = SmoothedPivotTargeForwardVector * GetCameraBehaviorParam("PivotOffset_X");
-			FVector PivotOffsetRight = SmoothedPivotTargeRightVector * GetCameraBehaviorParam("PivotOffset_Y");
-			FVector PivotOffsetUp = SmoothedPivotTargeUpVector * GetCameraBehaviorParam("PivotOffset_Z");
+			FVector PivotOffsetForward = SmoothedPivotTargeForwardVector * BehaviorParams.PivotOffset.X;
+			FVector PivotOffsetRight = SmoothedPivotTargeRightVector * BehaviorParams.PivotOffset.Y;
+			FVector PivotOffsetUp = SmoothedPivotTargeUpVector * BehaviorParams.PivotOffset.Z;
 
 			PivotLocation = SmoothedPivotTarget.GetLocation() + PivotOffsetForward + PivotOffsetRight + PivotOffsetUp;
 
@@ -129,9 +194,9 @@ bool AClimbCustomCameraManager::NativeUpdateCamera(AActor* CameraTarget, FVector
 			FVector TargetCameraRotationRightVector = TargetCameraRotation.Quaternion().GetRightVector();
 			FVector TargetCameraRotationUpVector = TargetCameraRotation.Quaternion().GetUpVector();
 
-			FVector CameraOffsetForwardVector = TargetCameraRotationForwardVector * GetCameraBehaviorParam("CameraOffset_X");
-			FVector CameraOffsetRightVector = TargetCameraRotationRightVector * GetCameraBehaviorParam("CameraOffset_Y");
-			FVector CameraOffsetUpVector = TargetCameraRotationUpVector * GetCameraBehaviorParam("CameraOffset_Z");
+			FVector CameraOffsetForwardVector = TargetCameraRotationForwardVector * BehaviorParams.CameraOffset.X;
+			FVector CameraOffsetRightVector = TargetCameraRotationRightVector * BehaviorParams.CameraOffset.Y;
+			FVector CameraOffsetUpVector = TargetCameraRotationUpVector * BehaviorParams.CameraOffset.Z;
 
 			TargetCameraLocation = PivotLocation + CameraOffsetForwardVector + CameraOffsetRightVector + CameraOffsetUpVector;
 
@@ -142,11 +207,19 @@ bool AClimbCustomCameraManager::NativeUpdateCamera(AActor* CameraTarget, FVector
 			FVector CameraTraceStart = PivotTarget.GetLocation();
 			FVector CameraTraceEnd = TargetCameraLocation;
 
-			FHitResult CameraTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(this, CameraTraceStart, CameraTraceEnd, CameraTrachRadius, {ControlPawn, this}, bDrawDebug, FLinearColor::Red, FLinearColor::Green, 0, ECollisionChannel::ECC_WorldStatic);
-
-			if(CameraTraceResult.IsValidBlockingHit())
+			if (bAsyncCameraProbe)
 			{
-				TargetCameraLocation = TargetCameraLocation + (CameraTraceResult.Location - CameraTraceResult.TraceEnd);
+				float FreeFraction = ProbeCameraCollisionAsync(CameraTraceStart, CameraTraceEnd);
+				TargetCameraLocation = CameraTraceStart + (CameraTraceEnd - CameraTraceStart) * FreeFraction;
+			}
+			else
+			{
+				FHitResult CameraTraceResult = UTraceBlueprintFunctionLibrary::SphereTrace(this, CameraTraceStart, CameraTraceEnd, CameraTrachRadius, {ControlPawn, this}, bDrawDebug, FLinearColor::Red, FLinearColor::Green, 0, ECollisionChannel::ECC_WorldStatic);
+
+				if(CameraTraceResult.IsValidBlockingHit())
+				{
+					TargetCameraLocation = TargetCameraLocation + (CameraTraceResult.Location - CameraTraceResult.TraceEnd);
+				}
 			}
 
 			//Step 7: Draw Debug Shapes.
@@ -176,6 +249,105 @@ bool AClimbCustomCameraManager::NativeUpdateCamera(AActor* CameraTarget, FVector
 	return false;
 }
 
+void AClimbCustomCameraManager::CachePawnCameraBinding()
+{
+	NativeCameraPawn = nullptr;
+	NativeCameraClimbComponent.Reset();
+	PawnSupportCameraEvent = nullptr;
+	PawnCameraParametersEvent = nullptr;
+	bCallPawnCameraEventsByName = false;
+
+	if (ControlPawn == nullptr)
+		return;
+
+	//The climb component stands in for the pawn's Blueprint camera events when asked to
+	const UClimbComponent* ClimbComponent = ControlPawn->FindComponentByClass<UClimbComponent>();
+	if (ClimbComponent != nullptr && ClimbComponent->bProvideCameraParameters && ControlPawn->IsA<ACharacter>())
+	{
+		NativeCameraClimbComponent = ClimbComponent;
+		return;
+	}
+
+	PawnSupportCameraEvent = ControlPawn->FindFunction(GET_FUNCTION_NAME_CHECKED(IClimbCustomCameraInterface, INT_PawnIsSupportClimbCustomCamera));
+	PawnCameraParametersEvent = ControlPawn->FindFunction(GET_FUNCTION_NAME_CHECKED(IClimbCustomCameraInterface, INT_GetCameraParameters));
+
+	//A native implementation that no Blueprint overrides needs no ProcessEvent at all
+	IClimbCustomCameraInterface* NativeInterface = Cast<IClimbCustomCameraInterface>(ControlPawn);
+	bool bSupportEventNative = PawnSupportCameraEvent == nullptr || PawnSupportCameraEvent->HasAnyFunctionFlags(FUNC_Native);
+	bool bParametersEventNative = PawnCameraParametersEvent == nullptr || PawnCameraParametersEvent->HasAnyFunctionFlags(FUNC_Native);
+
+	if (NativeInterface != nullptr && bSupportEventNative && bParametersEventNative)
+	{
+		NativeCameraPawn = NativeInterface;
+		PawnSupportCameraEvent = nullptr;
+		PawnCameraParametersEvent = nullptr;
+		return;
+	}
+
+	bool bSupportParmsMatch = PawnSupportCameraEvent == nullptr || PawnSupportCameraEvent->ParmsSize == sizeof(FClimbPawnSupportCameraParms);
+	bool bParametersParmsMatch = PawnCameraParametersEvent == nullptr || PawnCameraParametersEvent->ParmsSize == sizeof(FClimbPawnCameraParametersParms);
+
+	if (!bSupportParmsMatch || !bParametersParmsMatch)
+	{
+		UE_LOG(LogClimbCamera, Warning, TEXT("%s: camera interface parameters do not match the layouts the camera manager calls them with, calling them by name"), *GetNameSafe(ControlPawn));
+
+		PawnSupportCameraEvent = nullptr;
+		PawnCameraParametersEvent = nullptr;
+		bCallPawnCameraEventsByName = true;
+	}
+}
+
+bool AClimbCustomCameraManager::PawnIsSupportClimbCustomCamera()
+{
+	bool IsSupportClimbCustomCamera = false;
+
+	if (NativeCameraClimbComponent.IsValid())
+	{
+		IsSupportClimbCustomCamera = true;
+	}
+	else if (NativeCameraPawn != nullptr)
+	{
+		NativeCameraPawn->INT_PawnIsSupportClimbCustomCamera_Implementation(IsSupportClimbCustomCamera);
+	}
+	else if (PawnSupportCameraEvent != nullptr)
+	{
+		FClimbPawnSupportCameraParms Parms = { false };
+		ControlPawn->ProcessEvent(PawnSupportCameraEvent, &Parms);
+		IsSupportClimbCustomCamera = Parms.IsSupportClimbCustomCamera;
+	}
+	else if (bCallPawnCameraEventsByName)
+	{
+		IClimbCustomCameraInterface::Execute_INT_PawnIsSupportClimbCustomCamera(ControlPawn, IsSupportClimbCustomCamera);
+	}
+
+	return IsSupportClimbCustomCamera;
+}
+
+void AClimbCustomCameraManager::GetPawnCameraParameters(FTransform& OutPivotTarget, float& OutFOV, bool& OutRightShoulder)
+{
+	if (const UClimbComponent* ClimbComponent = NativeCameraClimbComponent.Get())
+	{
+		ClimbComponent->GetCameraParameters(OutPivotTarget, OutFOV, OutRightShoulder);
+	}
+	else if (NativeCameraPawn != nullptr)
+	{
+		NativeCameraPawn->INT_GetCameraParameters_Implementation(OutPivotTarget, OutFOV, OutRightShoulder);
+	}
+	else if (PawnCameraParametersEvent != nullptr)
+	{
+		FClimbPawnCameraParametersParms Parms = { OutPivotTarget, OutFOV, OutRightShoulder };
+		ControlPawn->ProcessEvent(PawnCameraParametersEvent, &Parms);
+
+		OutPivotTarget = Parms.PivotTarget;
+		OutFOV = Parms.FOV;
+		OutRightShoulder = Parms.RightShoulder;
+	}
+	else if (bCallPawnCameraEventsByName)
+	{
+		IClimbCustomCameraInterface::Execute_INT_GetCameraParameters(ControlPawn, OutPivotTarget, OutFOV, OutRightShoulder);
+	}
+}
+
 float AClimbCustomCameraManager::GetCameraBehaviorParam(FName CurveName)
 {
 	if(CameraAnimInstace == nullptr)
@@ -186,18 +358,113 @@ float AClimbCustomCameraManager::GetCameraBehaviorParam(FName CurveName)
 	return CameraAnimInstace->GetCurveValue(CurveName);
 }
 
-FVector AClimbCustomCameraManager::CalculateAxisIndependentLag(FVector CurrentLocation, FVector TargetLocation, FRotator CameraRotation, FVector LagSpeeds)
+void AClimbCustomCameraManager::GetCameraBehaviorParams(FClimbCameraBehaviorParams& OutParams) const
 {
-	float WorldDeltaSeconds = UGameplayStatics::GetWorldDeltaSeconds(this);
+	if (CameraAnimInstace == nullptr)
+	{
+		OutParams = FClimbCameraBehaviorParams();
+		return;
+	}
+
+	//One pass over the curve map for all parameters, missing curves read as 0 like GetCurveValue
+	const TMap<FName, float>& Curves = CameraAnimInstace->GetAnimationCurveList(EAnimCurveType::AttributeCurve);
+
+	float Values[(int32)EClimbCameraCurve::Num];
+	for (int32 CurveIndex = 0; CurveIndex < (int32)EClimbCameraCurve::Num; CurveIndex++)
+	{
+		Values[CurveIndex] = Curves.FindRef(ClimbCameraCurveNames[CurveIndex]);
+	}
 
-	FRotator CameraRotationYaw = FRotator(0, 0, CameraRotation.Yaw);
+	OutParams.RotationLagSpeed = Values[(int32)EClimbCameraCurve::RotationLagSpeed];
+	OutParams.PivotLagSpeed = FVector(Values[(int32)EClimbCameraCurve::PivotLagSpeed_X], Values[(int32)EClimbCameraCurve::PivotLagSpeed_Y], Values[(int32)EClimbCameraCurve::PivotLagSpeed_Z]);
+	OutParams.PivotOffset = FVector(Values[(int32)EClimbCameraCurve::PivotOffset_X], Values[(int32)EClimbCameraCurve::PivotOffset_Y], Values[(int32)EClimbCameraCurve::PivotOffset_Z]);
+	OutParams.CameraOffset = FVector(Values[(int32)EClimbCameraCurve::CameraOffset_X], Values[(int32)EClimbCameraCurve::CameraOffset_Y], Values[(int32)EClimbCameraCurve::CameraOffset_Z]);
+	OutParams.DebugAlpha = Values[(int32)EClimbCameraCurve::Override_Debug];
+}
 
-	FVector UnrotateCurrentLocation = CameraRotationYaw.UnrotateVector(CurrentLocation);
-	FVector UnrotateTargetLocation = CameraRotationYaw.UnrotateVector(TargetLocation);
+float AClimbCustomCameraManager::ProbeCameraCollisionAsync(const FVector& Start, const FVector& End)
+{
+	UWorld* World = GetWorld();
+	float Now = World->GetTimeSeconds();
+	FCollisionShape ProbeShape = FCollisionShape::MakeSphere(CameraTrachRadius);
+
+	//While the camera hugs the same wall, sweeping that one body skips the scene query.
+	//Other geometry is only seen by the next scene probe, once the cache expires, so it can be up to CameraBlockerCacheTime late
+	UPrimitiveComponent* Blocker = CameraBlocker.Get();
+	if (Blocker != nullptr && Now - CameraBlockerFoundTime < CameraBlockerCacheTime && Blocker->GetComponentTransform().Equals(CameraBlockerTransform))
+	{
+		FHitResult BlockerHit;
+		if (Blocker->SweepComponent(BlockerHit, Start, End, FQuat::Identity, ProbeShape))
+		{
+			if (bDrawDebug)
+			{
+				DrawDebugSphere(World, BlockerHit.Location, CameraTrachRadius, 8, FColor::Yellow);
+			}
 
-	float LerpX = FMath::FInterpTo( UnrotateCurrentLocation.X, UnrotateTargetLocation.X, WorldDeltaSeconds, LagSpeeds.X);
-	float LerpY = FMath::FInterpTo( UnrotateCurrentLocation.Y, UnrotateTargetLocation.Y, WorldDeltaSeconds, LagSpeeds.Y);
-	float LerpZ = FMath::FInterpTo( UnrotateCurrentLocation.Z, UnrotateTargetLocation.Z, WorldDeltaSeconds, LagSpeeds.Z);
+			//Counts as a sample, so the frame the cache expires still has a fresh one while the scene probe is in flight
+			CameraProbeHitTime = BlockerHit.Time;
+			CameraProbeHitTimeVelocity = 0;
+			CameraProbeSampleTime = Now;
+
+			return BlockerHit.Time;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_ClimbAsyncTraces);
+
+	uint32 ProbeId = (uint32)GFrameCounter;
+	CameraProbeIssueTimes[ProbeId % UE_ARRAY_COUNT(CameraProbeIssueTimes)] = Now;
+
+	World->AsyncSweepByObjectType(EAsyncTraceType::Single, Start, End, FQuat::Identity, FCollisionObjectQueryParams(ECC_TO_BITFIELD(ECC_WorldStatic)), ProbeShape, CameraProbeQueryParams, &CameraProbeDelegate, ProbeId);
+
+	if (CameraProbeSampleTime < 0)
+		return 1;
+
+	//After a hitch hold the last result rather than extrapolate it, pulled in is safer than popping through a wall
+	float SampleAge = Now - CameraProbeSampleTime;
+	if (SampleAge > CameraProbeMaxAge)
+		return CameraProbeHitTime;
+
+	//The result describes the camera as it was when the probe was issued, carry it forward to now
+	return FMath::Clamp(CameraProbeHitTime + CameraProbeHitTimeVelocity * SampleAge, 0.f, 1.f);
+}
+
+void AClimbCustomCameraManager::OnCameraProbeDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	float IssueTime = CameraProbeIssueTimes[TraceDatum.UserData % UE_ARRAY_COUNT(CameraProbeIssueTimes)];
+
+	//Results of probes issued before the newest sample, async or from the cached blocker, carry nothing new
+	if (IssueTime <= CameraProbeSampleTime)
+		return;
+
+	const FHitResult* Hit = TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].IsValidBlockingHit() ? &TraceDatum.OutHits[0] : nullptr;
+	float HitTime = Hit ? Hit->Time : 1.f;
+
+	//Only extrapolate between consecutive samples, a gap means the camera was doing something else
+	bool bConsecutive = CameraProbeSampleTime >= 0 && IssueTime - CameraProbeSampleTime <= CameraProbeMaxAge;
+	CameraProbeHitTimeVelocity = bConsecutive ? (HitTime - CameraProbeHitTime) / (IssueTime - CameraProbeSampleTime) : 0.f;
+	CameraProbeHitTime = HitTime;
+	CameraProbeSampleTime = IssueTime;
+
+	if (Hit != nullptr && Hit->GetComponent() != nullptr)
+	{
+		CameraBlocker = Hit->GetComponent();
+		CameraBlockerTransform = Hit->GetComponent()->GetComponentTransform();
+		CameraBlockerFoundTime = IssueTime;
+	}
+
+	if (bDrawDebug)
+	{
+#if ENABLE_DRAW_DEBUG
+		DrawDebugSphereTraceSingle(GetWorld(), TraceDatum.Start, TraceDatum.End, CameraTrachRadius, EDrawDebugTrace::ForOneFrame, Hit != nullptr, Hit ? *Hit : FHitResult(), FLinearColor::Red, FLinearColor::Green, 0);
+#endif
+	}
+}
+
+FVector AClimbCustomCameraManager::CalculateAxisIndependentLag(FVector CurrentLocation, FVector TargetLocation, FRotator CameraRotation, FVector LagSpeeds, float DeltaTime)
+{
+	//The yaw goes into Roll as it always has, the tuned lag speeds are relative to that space
+	FQuat LagSpace = FRotator(0, 0, CameraRotation.Yaw).Quaternion();
 
-	return CameraRotationYaw.RotateVector(FVector(LerpX, LerpY, LerpZ));
+	return FClimbCameraMath::AxisIndependentLag(CurrentLocation, TargetLocation, LagSpace, LagSpeeds, DeltaTime, PivotLagSubstepTime, bSpringPivotLag ? &SmoothedPivotVelocity : nullptr);
 }
@@ -8,6 +8,16 @@
 #include "ClimbCustomCameraInterface.h"
 #include "ClimbCustomCameraManager.generated.h"
 
+/** Camera behavior curves of the camera anim instance, read in one pass per frame. */
+struct FClimbCameraBehaviorParams
+{
+	float RotationLagSpeed = 0;
+	FVector PivotLagSpeed = FVector::ZeroVector;
+	FVector PivotOffset = FVector::ZeroVector;
+	FVector CameraOffset = FVector::ZeroVector;
+	float DebugAlpha = 0;
+};
+
 /**
  * 
  */
@@ -27,6 +37,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	bool bDrawDebug = false;
 
+	/** Sweep for camera collision through the async trace queue and apply the last result, extrapolated, instead of a synchronous sweep. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+	bool bAsyncCameraProbe = false;
+
+	/** Seconds a wall found by the async probe is swept on its own instead of probing the scene. Other geometry can be noticed this much later. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+	float CameraBlockerCacheTime = 0.25f;
+
+	/** Async results older than this many seconds are held instead of extrapolated. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+	float CameraProbeMaxAge = 0.1f;
+
+	/** Lag the pivot with critically damped springs instead of FInterpTo, the PivotLagSpeed curves become the spring frequencies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+	bool bSpringPivotLag = false;
+
+	/** Longest step the pivot lag is advanced by, longer frames are split into substeps. 0 advances once per frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+	float PivotLagSubstepTime = 0;
+
 	virtual void BeginPlay() override;
 
 	void INT_OnPossess_Implementation(APawn* ControlledPawn);
@@ -35,12 +65,38 @@ protected:
 
 	virtual bool NativeUpdateCamera(AActor* CameraTarget, FVector& NewCameraLocation, FRotator& NewCameraRotation, float& NewCameraFOV);
 
+	/** Looks up how the possessed pawn implements the camera interface, so the per frame calls skip the lookup by name. */
+	void CachePawnCameraBinding();
+	bool PawnIsSupportClimbCustomCamera();
+	void GetPawnCameraParameters(FTransform& OutPivotTarget, float& OutFOV, bool& OutRightShoulder);
+
 	float GetCameraBehaviorParam(FName CurveName);
-	FVector CalculateAxisIndependentLag(FVector CurrentLocation, FVector TargetLocation, FRotator CameraRotation, FVector LagSpeeds);
+	void GetCameraBehaviorParams(FClimbCameraBehaviorParams& OutParams) const;
+	FVector CalculateAxisIndependentLag(FVector CurrentLocation, FVector TargetLocation, FRotator CameraRotation, FVector LagSpeeds, float DeltaTime);
+
+	/** Fraction of the sweep from Start to End that is free this frame, from the cached blocker or the last async probe. Issues the next probe. */
+	float ProbeCameraCollisionAsync(const FVector& Start, const FVector& End);
+	void OnCameraProbeDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
 
 	UAnimInstance* CameraAnimInstace;
 
 	APawn* ControlPawn;
+
+	/** Whether a Blueprint subclass overrides BlueprintUpdateCamera, looked up once in BeginPlay. */
+	bool bBlueprintUpdateCameraImplemented = true;
+
+	/** Set when ControlPawn implements the camera interface natively without Blueprint overrides, called directly. */
+	IClimbCustomCameraInterface* NativeCameraPawn = nullptr;
+
+	/** Set when ControlPawn has a UClimbComponent that provides the camera parameters, read directly. */
+	TWeakObjectPtr<const class UClimbComponent> NativeCameraClimbComponent;
+
+	/** Camera interface events of a Blueprint ControlPawn, called with ProcessEvent. */
+	UFunction* PawnSupportCameraEvent = nullptr;
+	UFunction* PawnCameraParametersEvent = nullptr;
+
+	/** The events did not match the parameter layouts ProcessEvent is called with, go through the generated Execute functions instead. */
+	bool bCallPawnCameraEventsByName = false;
 	FTransform PivotTarget;
 	float FOV;
 	bool RightShoulder;
@@ -51,5 +107,21 @@ protected:
 	FRotator DebugViewRotation = FRotator(0, -5, 180);
 	FVector DebugViewOffset = FVector(350, 0, 50);
 	FTransform SmoothedPivotTarget;
+	FVector SmoothedPivotVelocity = FVector::ZeroVector;
 	FVector PivotLocation;
+
+	FCollisionQueryParams CameraProbeQueryParams;
+	FTraceDelegate CameraProbeDelegate;
+
+	/** World time each in flight probe was issued at, indexed by its user data. */
+	float CameraProbeIssueTimes[4] = {};
+
+	/** Hit time of the newest async probe result or cached blocker sweep, how fast it changes per second and when it was taken. */
+	float CameraProbeHitTime = 1;
+	float CameraProbeHitTimeVelocity = 0;
+	float CameraProbeSampleTime = -1;
+
+	TWeakObjectPtr<UPrimitiveComponent> CameraBlocker;
+	FTransform CameraBlockerTransform;
+	float CameraBlockerFoundTime = -1;
 };
@@ -0,0 +1,304 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbFeatureBakeCommandlet.h"
+#include "Algo/Sort.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "EngineUtils.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbFeatureBake, Log, All);
+
+UClimbFeatureBakeCommandlet::UClimbFeatureBakeCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UClimbFeatureBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	const FString* MapParam = ParamsMap.Find(TEXT("Map"));
+	if (MapParam == nullptr)
+	{
+		UE_LOG(LogClimbFeatureBake, Error, TEXT("Missing -Map=<map package>[,<map package>...]"));
+		return 1;
+	}
+
+	TArray<FString> MapPackageNames;
+	MapParam->ParseIntoArray(MapPackageNames, TEXT(","));
+
+	int32 FailedMaps = 0;
+	for (const FString& MapPackageName : MapPackageNames)
+	{
+		if (!BakeMap(MapPackageName))
+			FailedMaps++;
+	}
+
+	return FailedMaps > 0 ? 1 : 0;
+#else
+	UE_LOG(LogClimbFeatureBake, Error, TEXT("Climb features can only be baked in the editor"));
+	return 1;
+#endif
+}
+
+bool UClimbFeatureBakeCommandlet::BakeMap(const FString& MapPackageName)
+{
+#if WITH_EDITOR
+	UPackage* MapPackage = LoadPackage(nullptr, *MapPackageName, LOAD_None);
+	UWorld* World = MapPackage != nullptr ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogClimbFeatureBake, Error, TEXT("Could not load map %s"), *MapPackageName);
+		return false;
+	}
+
+	//Components need their world transforms, so bring the world up without physics or gameplay
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	World->InitWorld(UWorld::InitializationValues()
+		.AllowAudioPlayback(false)
+		.CreatePhysicsScene(false)
+		.RequiresHitProxies(false)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.ShouldSimulatePhysics(false)
+		.SetTransactional(false));
+	World->UpdateWorldComponents(true, false);
+
+	TArray<FBakeBox> Boxes;
+	GatherBoxes(World, Boxes);
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+
+	TArray<FClimbFeature> Features;
+	for (const FBakeBox& Box : Boxes)
+	{
+		BakeBox(Box, Features);
+	}
+
+	BakeNarrowSpaces(Boxes, Features);
+
+	//Same name the runtime derives from the loaded world, whatever form the map was passed in
+	FString IndexPackageName = UClimbFeatureIndex::GetIndexPackageName(MapPackage->GetName());
+	UPackage* IndexPackage = CreatePackage(*IndexPackageName);
+
+	UClimbFeatureIndex* FeatureIndex = NewObject<UClimbFeatureIndex>(IndexPackage, *FPackageName::GetShortName(IndexPackageName), RF_Public | RF_Standalone);
+	FeatureIndex->SetFeatures(Features);
+	IndexPackage->MarkPackageDirty();
+
+	FString IndexFilename = FPackageName::LongPackageNameToFilename(IndexPackageName, FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if (!UPackage::SavePackage(IndexPackage, FeatureIndex, *IndexFilename, SaveArgs))
+	{
+		UE_LOG(LogClimbFeatureBake, Error, TEXT("Could not save %s"), *IndexFilename);
+		return false;
+	}
+
+	UE_LOG(LogClimbFeatureBake, Display, TEXT("Baked %d climb features from %d boxes of %s into %s"), Features.Num(), Boxes.Num(), *MapPackageName, *IndexPackageName);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void UClimbFeatureBakeCommandlet::GatherBoxes(UWorld* World, TArray<FBakeBox>& OutBoxes) const
+{
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		TInlineComponentArray<UStaticMeshComponent*> StaticMeshComponents(*It);
+
+		for (UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+		{
+			//Only what the runtime detection traces can hit, and what never moves
+			if (StaticMeshComponent->Mobility != EComponentMobility::Static ||
+				StaticMeshComponent->GetCollisionEnabled() == ECollisionEnabled::NoCollision ||
+				StaticMeshComponent->GetCollisionObjectType() != ECollisionChannel::ECC_WorldStatic)
+				continue;
+
+			UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+			UBodySetup* BodySetup = StaticMesh != nullptr ? StaticMesh->GetBodySetup() : nullptr;
+			if (BodySetup == nullptr)
+				continue;
+
+			//Traces against complex collision hit the triangles, not the simple shapes baked here
+			if (BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple)
+			{
+				UE_LOG(LogClimbFeatureBake, Verbose, TEXT("Skipping %s, it uses complex collision as simple"), *StaticMeshComponent->GetPathName());
+				continue;
+			}
+
+			FTransform ComponentTransform = StaticMeshComponent->GetComponentTransform();
+
+			//Only box collision is baked, its faces are exactly what the traces hit unlike the bounds of the mesh
+			for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+			{
+				FTransform ElemTransform = BoxElem.GetTransform() * ComponentTransform;
+
+				FBakeBox Box;
+				Box.Center = ElemTransform.GetLocation();
+				Box.Extent = FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * 0.5 * ElemTransform.GetScale3D().GetAbs();
+				Box.Axis[0] = ElemTransform.GetUnitAxis(EAxis::X);
+				Box.Axis[1] = ElemTransform.GetUnitAxis(EAxis::Y);
+				Box.Axis[2] = ElemTransform.GetUnitAxis(EAxis::Z);
+
+				if (Box.Extent.GetMax() < 5)
+					continue;
+
+				OutBoxes.Add(Box);
+			}
+		}
+	}
+}
+
+void UClimbFeatureBakeCommandlet::BakeBox(const FBakeBox& Box, TArray<FClimbFeature>& OutFeatures) const
+{
+	int32 Order[3] = { 0, 1, 2 };
+	Algo::Sort(Order, [&Box](int32 A, int32 B) { return Box.Extent[A] < Box.Extent[B]; });
+
+	//Thin in two directions, long in the third
+	if (Box.Extent[Order[1]] <= PipeMaxRadius && Box.Extent[Order[2]] > 2 * PipeMaxRadius)
+	{
+		FVector PipeAxis = Box.Axis[Order[2]] * Box.Extent[Order[2]];
+		float PipeRadius = (Box.Extent[Order[0]] + Box.Extent[Order[1]]) / 2;
+
+		OutFeatures.Add(MakeFeature(EClimbFeatureType::Pipe, Box.Center - PipeAxis, Box.Center + PipeAxis, FVector::ZeroVector, PipeRadius, 0));
+		return;
+	}
+
+	if (!IsUpright(Box))
+		return;
+
+	FVector UpVector = Box.Axis[2] * FMath::Sign(Box.Axis[2].Z);
+	FVector TopCenter = Box.Center + UpVector * Box.Extent.Z;
+	float Height = Box.Extent.Z * 2;
+
+	int32 NarrowAxis = Box.Extent.X < Box.Extent.Y ? 0 : 1;
+	int32 LongAxis = 1 - NarrowAxis;
+	float Width = Box.Extent[NarrowAxis] * 2;
+	FVector LongVector = Box.Axis[LongAxis] * Box.Extent[LongAxis];
+
+	if (Width < BalanceBeamMaxWidth)
+	{
+		OutFeatures.Add(MakeFeature(EClimbFeatureType::BalanceBeam, TopCenter - LongVector, TopCenter + LongVector, Box.Axis[NarrowAxis], Width, Height));
+	}
+	else if (Width < LedgeWalkMaxWidth)
+	{
+		for (float Side : { 1.f, -1.f })
+		{
+			FVector EdgeNormal = Box.Axis[NarrowAxis] * Side;
+			FVector EdgeCenter = TopCenter + EdgeNormal * Box.Extent[NarrowAxis];
+
+			OutFeatures.Add(MakeFeature(EClimbFeatureType::LedgeWalkEdge, EdgeCenter - LongVector, EdgeCenter + LongVector, EdgeNormal, Width, Height));
+		}
+	}
+
+	//Every side face of an upright box has a ledge on top
+	for (int32 AxisIndex = 0; AxisIndex < 2; AxisIndex++)
+	{
+		FVector EdgeVector = Box.Axis[1 - AxisIndex] * Box.Extent[1 - AxisIndex];
+
+		for (float Side : { 1.f, -1.f })
+		{
+			FVector FaceNormal = Box.Axis[AxisIndex] * Side;
+			FVector EdgeCenter = TopCenter + FaceNormal * Box.Extent[AxisIndex];
+
+			OutFeatures.Add(MakeFeature(EClimbFeatureType::Ledge, EdgeCenter - EdgeVector, EdgeCenter + EdgeVector, FaceNormal, 0, Height));
+		}
+	}
+}
+
+void UClimbFeatureBakeCommandlet::BakeNarrowSpaces(const TArray<FBakeBox>& Boxes, TArray<FClimbFeature>& OutFeatures) const
+{
+	TArray<const FBakeBox*> Walls;
+	for (const FBakeBox& Box : Boxes)
+	{
+		if (IsUpright(Box) && Box.Extent.Z * 2 >= NarrowSpaceMinHeight)
+			Walls.Add(&Box);
+	}
+
+	for (int32 i = 0; i < Walls.Num(); i++)
+	{
+		const FBakeBox& WallA = *Walls[i];
+
+		for (int32 j = i + 1; j < Walls.Num(); j++)
+		{
+			const FBakeBox& WallB = *Walls[j];
+
+			float MaxReach = WallA.Extent.Size2D() + WallB.Extent.Size2D() + NarrowSpaceWidthRange.Y;
+			if (FVector::DistSquared2D(WallA.Center, WallB.Center) > MaxReach * MaxReach)
+				continue;
+
+			for (int32 AxisA = 0; AxisA < 2; AxisA++)
+			{
+				FVector AcrossVector = WallA.Axis[AxisA];
+
+				int32 AxisB = FMath::Abs(FVector::DotProduct(WallB.Axis[0], AcrossVector)) > 0.99 ? 0 :
+							  (FMath::Abs(FVector::DotProduct(WallB.Axis[1], AcrossVector)) > 0.99 ? 1 : INDEX_NONE);
+				if (AxisB == INDEX_NONE)
+					continue;
+
+				float Offset = FVector::DotProduct(WallB.Center - WallA.Center, AcrossVector);
+				float Side = Offset >= 0 ? 1 : -1;
+				float Gap = FMath::Abs(Offset) - WallA.Extent[AxisA] - WallB.Extent[AxisB];
+				if (Gap < NarrowSpaceWidthRange.X || Gap > NarrowSpaceWidthRange.Y)
+					continue;
+
+				//The walls have to face each other along a stretch at least as long as the corridor is wide
+				FVector AlongVector = WallA.Axis[1 - AxisA];
+				float CenterA = FVector::DotProduct(WallA.Center, AlongVector);
+				float CenterB = FVector::DotProduct(WallB.Center, AlongVector);
+				float OverlapMin = FMath::Max(CenterA - WallA.Extent[1 - AxisA], CenterB - WallB.Extent[1 - AxisB]);
+				float OverlapMax = FMath::Min(CenterA + WallA.Extent[1 - AxisA], CenterB + WallB.Extent[1 - AxisB]);
+				if (OverlapMax - OverlapMin < Gap)
+					continue;
+
+				float FloorZ = FMath::Max(WallA.Center.Z - WallA.Extent.Z, WallB.Center.Z - WallB.Extent.Z);
+				float CorridorHeight = FMath::Min(WallA.Center.Z + WallA.Extent.Z, WallB.Center.Z + WallB.Extent.Z) - FloorZ;
+
+				FVector CorridorCenter = WallA.Center + AcrossVector * Side * (WallA.Extent[AxisA] + Gap / 2);
+				CorridorCenter -= AlongVector * FVector::DotProduct(CorridorCenter, AlongVector);
+				CorridorCenter.Z = FloorZ;
+
+				OutFeatures.Add(MakeFeature(EClimbFeatureType::NarrowSpace,
+											CorridorCenter + AlongVector * OverlapMin,
+											CorridorCenter + AlongVector * OverlapMax,
+											AcrossVector * Side, Gap, CorridorHeight));
+				break;
+			}
+		}
+	}
+}
+
+bool UClimbFeatureBakeCommandlet::IsUpright(const FBakeBox& Box)
+{
+	return FMath::Abs(Box.Axis[2].Z) > 0.99;
+}
+
+FClimbFeature UClimbFeatureBakeCommandlet::MakeFeature(EClimbFeatureType Type, const FVector& Start, const FVector& End, const FVector& Normal, float Width, float Height)
+{
+	FClimbFeature Feature;
+	Feature.Start = FVector3f(Start);
+	Feature.End = FVector3f(End);
+	Feature.Normal = FVector3f(Normal);
+	Feature.Width = Width;
+	Feature.Height = Height;
+	Feature.Type = Type;
+
+	return Feature;
+}
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ClimbFeatureIndex.h"
+#include "ClimbFeatureBakeCommandlet.generated.h"
+
+/**
+ * Bakes the climbable features of static level geometry into a UClimbFeatureIndex per map.
+ * Only the box elements of the meshes' simple collision are baked, other shapes and complex collision are left to the traces.
+ * Usage: UnrealEditor-Cmd.exe ClimbingSystem.uproject -run=ClimbFeatureBake -Map=/Game/Maps/MapA,/Game/Maps/MapB
+ */
+UCLASS(Config = Editor)
+class CLIMBINGSYSTEM_API UClimbFeatureBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UClimbFeatureBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Boxes whose two smaller half extents are below this are baked as pipes. */
+	UPROPERTY(Config)
+	float PipeMaxRadius = 15;
+
+	/** Upright boxes narrower than this are baked as balance beams. */
+	UPROPERTY(Config)
+	float BalanceBeamMaxWidth = 30;
+
+	/** Upright boxes narrower than this, but wider than a beam, get ledge walk edges along their long sides. */
+	UPROPERTY(Config)
+	float LedgeWalkMaxWidth = 80;
+
+	/** Gap between two parallel walls that is baked as a narrow space corridor. */
+	UPROPERTY(Config)
+	FVector2D NarrowSpaceWidthRange = FVector2D(30, 80);
+
+	/** Walls lower than this do not form narrow spaces. */
+	UPROPERTY(Config)
+	float NarrowSpaceMinHeight = 150;
+
+private:
+	struct FBakeBox
+	{
+		FVector Center;
+		FVector Axis[3];
+		FVector Extent;
+	};
+
+	bool BakeMap(const FString& MapPackageName);
+
+	void GatherBoxes(UWorld* World, TArray<FBakeBox>& OutBoxes) const;
+	void BakeBox(const FBakeBox& Box, TArray<FClimbFeature>& OutFeatures) const;
+	void BakeNarrowSpaces(const TArray<FBakeBox>& Boxes, TArray<FClimbFeature>& OutFeatures) const;
+
+	static bool IsUpright(const FBakeBox& Box);
+	static FClimbFeature MakeFeature(EClimbFeatureType Type, const FVector& Start, const FVector& End, const FVector& Normal, float Width, float Height);
+};
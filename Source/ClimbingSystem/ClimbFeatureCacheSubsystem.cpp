@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbFeatureCacheSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "TimerManager.h"
+
+void UClimbFeatureCacheSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	//Destroyed primitives do not fire transform updates, sweep for them now and then instead of on every insert
+	InWorld.GetTimerManager().SetTimer(StalePruneTimerHandle, this, &UClimbFeatureCacheSubsystem::RemoveStalePrimitives, StalePruneInterval, true);
+}
+
+void UClimbFeatureCacheSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(StalePruneTimerHandle);
+	}
+
+	Reset();
+
+	Super::Deinitialize();
+}
+
+bool UClimbFeatureCacheSubsystem::FindFeature(EClimbFeatureType Type, const FVector& Location, const FVector& Normal, FClimbCachedFeature& OutFeature)
+{
+	//A feature just across a cell border is as close as one in the same cell, look in every cell within reach
+	float MatchDistance = CellSize * 0.5f;
+	FIntVector MinCell = GetCell(Location - FVector(MatchDistance));
+	FIntVector MaxCell = GetCell(Location + FVector(MatchDistance));
+
+	double BestDistanceSquared = FMath::Square(MatchDistance);
+	bool bFound = false;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				TArray<FClimbCachedFeature>* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (Cell == nullptr)
+					continue;
+
+				for (int32 i = Cell->Num() - 1; i >= 0; i--)
+				{
+					const FClimbCachedFeature& Feature = (*Cell)[i];
+
+					//Drop entries of destroyed primitives as they are met, the timer clears the rest
+					if (!Feature.SourcePrimitive.IsValid())
+					{
+						Cell->RemoveAtSwap(i);
+						NumFeatures--;
+						continue;
+					}
+
+					if (Feature.Type != Type)
+						continue;
+
+					double DistanceSquared = FVector::DistSquared(Feature.Location, Location);
+					if (DistanceSquared > BestDistanceSquared)
+						continue;
+
+					float Alignment = FVector::DotProduct(Feature.Normal, Normal);
+					if (Type == EClimbFeatureType::Pipe || Type == EClimbFeatureType::BalanceBeam)
+						Alignment = FMath::Abs(Alignment);
+
+					if (Alignment >= 0.99)
+					{
+						//Copied, later removals in the cell move its entries around
+						OutFeature = Feature;
+						BestDistanceSquared = DistanceSquared;
+						bFound = true;
+					}
+				}
+			}
+		}
+	}
+
+	return bFound;
+}
+
+void UClimbFeatureCacheSubsystem::AddFeature(EClimbFeatureType Type, const FVector& Location, const FVector& Normal, const FVector& EndLocation, UPrimitiveComponent* SourcePrimitive)
+{
+	if (SourcePrimitive == nullptr)
+		return;
+
+	if (NumFeatures >= MaxFeatures)
+	{
+		RemoveStalePrimitives();
+
+		if (NumFeatures >= MaxFeatures)
+			Reset();
+	}
+
+	FIntVector CellKey = GetCell(Location);
+
+	FClimbCachedFeature& Feature = Cells.FindOrAdd(CellKey).AddDefaulted_GetRef();
+	Feature.Location = Location;
+	Feature.Normal = Normal;
+	Feature.EndLocation = EndLocation;
+	Feature.Type = Type;
+	Feature.SourcePrimitive = SourcePrimitive;
+	NumFeatures++;
+
+	FWatchedPrimitive* WatchedPrimitive = WatchedPrimitives.Find(SourcePrimitive);
+	if (WatchedPrimitive == nullptr)
+	{
+		WatchedPrimitive = &WatchedPrimitives.Add(SourcePrimitive);
+		WatchedPrimitive->TransformUpdatedHandle = SourcePrimitive->TransformUpdated.AddUObject(this, &UClimbFeatureCacheSubsystem::OnPrimitiveTransformUpdated);
+	}
+
+	WatchedPrimitive->CellKeys.AddUnique(CellKey);
+}
+
+void UClimbFeatureCacheSubsystem::InvalidatePrimitive(UPrimitiveComponent* SourcePrimitive)
+{
+	FWatchedPrimitive WatchedPrimitive;
+	if (!WatchedPrimitives.RemoveAndCopyValue(SourcePrimitive, WatchedPrimitive))
+		return;
+
+	SourcePrimitive->TransformUpdated.Remove(WatchedPrimitive.TransformUpdatedHandle);
+
+	for (const FIntVector& CellKey : WatchedPrimitive.CellKeys)
+	{
+		TArray<FClimbCachedFeature>* Cell = Cells.Find(CellKey);
+		if (Cell == nullptr)
+			continue;
+
+		NumFeatures -= Cell->RemoveAllSwap([SourcePrimitive](const FClimbCachedFeature& Feature) { return Feature.SourcePrimitive == SourcePrimitive; });
+
+		if (Cell->Num() == 0)
+			Cells.Remove(CellKey);
+	}
+}
+
+void UClimbFeatureCacheSubsystem::OnPrimitiveTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	InvalidatePrimitive(CastChecked<UPrimitiveComponent>(UpdatedComponent));
+}
+
+void UClimbFeatureCacheSubsystem::RemoveStalePrimitives()
+{
+	for (auto It = WatchedPrimitives.CreateIterator(); It; ++It)
+	{
+		UPrimitiveComponent* SourcePrimitive = It->Key.Get();
+		if (SourcePrimitive != nullptr && SourcePrimitive->IsRegistered())
+			continue;
+
+		if (SourcePrimitive != nullptr)
+			SourcePrimitive->TransformUpdated.Remove(It->Value.TransformUpdatedHandle);
+
+		//The key no longer resolves once destroyed, so match the entries by their own stale pointers
+		for (const FIntVector& CellKey : It->Value.CellKeys)
+		{
+			TArray<FClimbCachedFeature>* Cell = Cells.Find(CellKey);
+			if (Cell == nullptr)
+				continue;
+
+			NumFeatures -= Cell->RemoveAllSwap([SourcePrimitive](const FClimbCachedFeature& Feature) { return !Feature.SourcePrimitive.IsValid() || Feature.SourcePrimitive.Get() == SourcePrimitive; });
+
+			if (Cell->Num() == 0)
+				Cells.Remove(CellKey);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+void UClimbFeatureCacheSubsystem::Reset()
+{
+	for (TPair<TWeakObjectPtr<UPrimitiveComponent>, FWatchedPrimitive>& WatchedPrimitive : WatchedPrimitives)
+	{
+		if (UPrimitiveComponent* SourcePrimitive = WatchedPrimitive.Key.Get())
+			SourcePrimitive->TransformUpdated.Remove(WatchedPrimitive.Value.TransformUpdatedHandle);
+	}
+
+	WatchedPrimitives.Reset();
+	Cells.Reset();
+	NumFeatures = 0;
+}
+
+FIntVector UClimbFeatureCacheSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt32(Location.X / CellSize),
+					  FMath::FloorToInt32(Location.Y / CellSize),
+					  FMath::FloorToInt32(Location.Z / CellSize));
+}
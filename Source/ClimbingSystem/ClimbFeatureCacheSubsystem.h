@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbFeatureIndex.h"
+#include "ClimbFeatureCacheSubsystem.generated.h"
+
+/** A climbable feature found by a detection pass, and what the pass derived from it. */
+struct FClimbCachedFeature
+{
+	/** Where the feature was detected. */
+	FVector Location;
+	FVector Normal;
+
+	/** What the detection pass found from Location, e.g. the hang target below a ledge. */
+	FVector EndLocation;
+
+	EClimbFeatureType Type;
+	TWeakObjectPtr<UPrimitiveComponent> SourcePrimitive;
+};
+
+/**
+ * Spatial hash of climbable features discovered at runtime, shared by every climb component in the world.
+ * Only the scans that follow a detection are cached, e.g. the hang target below a ledge or the extent of a beam.
+ * The obstacle and floor traces that find the feature still run every pass, they also tell whether anything is there at all.
+ * Entries are dropped when their source primitive moves. Unregistered or destroyed primitives are pruned every StalePruneInterval.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbFeatureCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Finds the closest feature detected within half a cell of Location, across cell borders, facing the same way as Normal.
+	 * Pipes and beams pass their axis as Normal, either way along it matches.
+	 */
+	bool FindFeature(EClimbFeatureType Type, const FVector& Location, const FVector& Normal, FClimbCachedFeature& OutFeature);
+
+	void AddFeature(EClimbFeatureType Type, const FVector& Location, const FVector& Normal, const FVector& EndLocation, UPrimitiveComponent* SourcePrimitive);
+
+	void InvalidatePrimitive(UPrimitiveComponent* SourcePrimitive);
+
+	float CellSize = 10;
+	int32 MaxFeatures = 4096;
+
+	/** Seconds between passes over the watched primitives for destroyed or unregistered ones. */
+	float StalePruneInterval = 5;
+
+private:
+	struct FWatchedPrimitive
+	{
+		FDelegateHandle TransformUpdatedHandle;
+		TArray<FIntVector> CellKeys;
+	};
+
+	void OnPrimitiveTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Drops the primitives that were destroyed or unregistered without moving, and their entries. */
+	void RemoveStalePrimitives();
+
+	void Reset();
+
+	FIntVector GetCell(const FVector& Location) const;
+
+	TMap<FIntVector, TArray<FClimbCachedFeature>> Cells;
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FWatchedPrimitive> WatchedPrimitives;
+	int32 NumFeatures = 0;
+
+	FTimerHandle StalePruneTimerHandle;
+};
@@ -0,0 +1,228 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbFeatureIndex.h"
+#include "Misc/PackageName.h"
+#include "Engine/World.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbFeatureIndex, Log, All);
+
+void UClimbFeatureIndex::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	FeatureData.Serialize(Ar, this);
+}
+
+void UClimbFeatureIndex::PostLoad()
+{
+	Super::PostLoad();
+
+	Features.Reset();
+
+	int64 DataSize = FeatureData.GetBulkDataSize();
+	if (DataSize > 0)
+	{
+		const uint8* Data = (const uint8*)FeatureData.LockReadOnly();
+		FMemoryReaderView Reader(MakeArrayView(Data, DataSize));
+
+		int32 Version = 0;
+		Reader << Version;
+
+		if (Version == FeatureFormatVersion)
+		{
+			Reader << Features;
+		}
+		else
+		{
+			UE_LOG(LogClimbFeatureIndex, Warning, TEXT("%s was baked in an unknown climb feature format, bake the map again"), *GetPathName());
+		}
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogClimbFeatureIndex, Warning, TEXT("%s has truncated climb feature data, bake the map again"), *GetPathName());
+			Features.Reset();
+		}
+
+		FeatureData.Unlock();
+	}
+
+	BuildGrid();
+}
+
+#if WITH_EDITOR
+void UClimbFeatureIndex::SetFeatures(const TArray<FClimbFeature>& InFeatures)
+{
+	Features = InFeatures;
+	FeatureCount = Features.Num();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, true);
+
+	int32 Version = FeatureFormatVersion;
+	Writer << Version;
+	Writer << Features;
+
+	FeatureData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(FeatureData.Realloc(Bytes.Num()), Bytes.GetData(), Bytes.Num());
+	FeatureData.Unlock();
+
+	//Keep the payload out of the export so it can be streamed separately
+	FeatureData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+
+	BuildGrid();
+}
+#endif
+
+bool UClimbFeatureIndex::SweepFeatureFaces(EClimbFeatureType Type, const FVector& Start, const FVector& End, float Radius, FVector& OutLocation, FVector& OutNormal) const
+{
+	FVector Delta = End - Start;
+
+	FBox SweepBounds(ForceInit);
+	SweepBounds += Start;
+	SweepBounds += End;
+	SweepBounds = SweepBounds.ExpandBy(Radius);
+
+	FIntVector MinCell = GetCell(SweepBounds.Min);
+	FIntVector MaxCell = GetCell(SweepBounds.Max);
+
+	float BestTime = TNumericLimits<float>::Max();
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (Cell == nullptr)
+					continue;
+
+				for (int32 FeatureIndex : *Cell)
+				{
+					const FClimbFeature& Feature = Features[FeatureIndex];
+					if (Feature.Type != Type)
+						continue;
+
+					FVector FaceNormal = FVector(Feature.Normal);
+					FVector EdgeStart = FVector(Feature.Start);
+
+					//Only faces the sweep moves into, starting in front of them
+					float Approach = FVector::DotProduct(Delta, FaceNormal);
+					if (Approach >= 0 || FVector::DotProduct(Start - EdgeStart, FaceNormal) < 0)
+						continue;
+
+					float Time = FVector::DotProduct(EdgeStart + FaceNormal * Radius - Start, FaceNormal) / Approach;
+					if (Time < 0 || Time > 1 || Time >= BestTime)
+						continue;
+
+					FVector ImpactPoint = Start + Delta * Time - FaceNormal * Radius;
+
+					FVector EdgeVector = FVector(Feature.End) - EdgeStart;
+					float EdgeLength = EdgeVector.Size();
+					FVector EdgeDirection = EdgeLength > 0 ? EdgeVector / EdgeLength : FVector::ZeroVector;
+
+					float AlongEdge = FVector::DotProduct(ImpactPoint - EdgeStart, EdgeDirection);
+					if (AlongEdge < -Radius || AlongEdge > EdgeLength + Radius)
+						continue;
+
+					float BelowEdge = EdgeStart.Z + EdgeDirection.Z * AlongEdge - ImpactPoint.Z;
+					if (BelowEdge < -Radius || BelowEdge > Feature.Height + Radius)
+						continue;
+
+					BestTime = Time;
+
+					OutLocation = EdgeStart +
+								  EdgeDirection * FMath::Clamp(AlongEdge, 0.f, EdgeLength) +
+								  FVector::DownVector * FMath::Clamp(BelowEdge, 0.f, Feature.Height);
+					OutNormal = FaceNormal;
+				}
+			}
+		}
+	}
+
+	return BestTime <= 1;
+}
+
+void UClimbFeatureIndex::QueryFeatures(EClimbFeatureType Type, const FBox& Bounds, TArray<const FClimbFeature*>& OutFeatures) const
+{
+	FIntVector MinCell = GetCell(Bounds.Min);
+	FIntVector MaxCell = GetCell(Bounds.Max);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (Cell == nullptr)
+					continue;
+
+				for (int32 FeatureIndex : *Cell)
+				{
+					if (Features[FeatureIndex].Type == Type)
+						OutFeatures.AddUnique(&Features[FeatureIndex]);
+				}
+			}
+		}
+	}
+}
+
+FString UClimbFeatureIndex::GetIndexPackageName(const FString& MapPackageName)
+{
+	//e.g. /Game/Maps/Arena -> /Game/ClimbFeatures/Game/Maps/Arena_ClimbFeatures, plugin maps keep their mount point the same way
+	FString MapPath = MapPackageName;
+	MapPath.RemoveFromStart(TEXT("/"));
+
+	return FString::Printf(TEXT("/Game/ClimbFeatures/%s_ClimbFeatures"), *MapPath);
+}
+
+UClimbFeatureIndex* UClimbFeatureIndex::LoadForWorld(const UWorld* World)
+{
+	FString MapName = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+	FString IndexPackageName = GetIndexPackageName(MapName);
+	FString IndexObjectPath = IndexPackageName + TEXT(".") + FPackageName::GetShortName(IndexPackageName);
+
+	return LoadObject<UClimbFeatureIndex>(nullptr, *IndexObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+}
+
+void UClimbFeatureIndex::BuildGrid()
+{
+	Cells.Reset();
+
+	for (int32 i = 0; i < Features.Num(); i++)
+	{
+		const FClimbFeature& Feature = Features[i];
+
+		FBox FeatureBounds(ForceInit);
+		FeatureBounds += FVector(Feature.Start);
+		FeatureBounds += FVector(Feature.End);
+		FeatureBounds += FVector(Feature.Start) + FVector::DownVector * Feature.Height;
+		FeatureBounds += FVector(Feature.End) + FVector::DownVector * Feature.Height;
+		FeatureBounds = FeatureBounds.ExpandBy(Feature.Width);
+
+		FIntVector MinCell = GetCell(FeatureBounds.Min);
+		FIntVector MaxCell = GetCell(FeatureBounds.Max);
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+				{
+					Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(i);
+				}
+			}
+		}
+	}
+}
+
+FIntVector UClimbFeatureIndex::GetCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt32(Location.X / CellSize),
+					  FMath::FloorToInt32(Location.Y / CellSize),
+					  FMath::FloorToInt32(Location.Z / CellSize));
+}
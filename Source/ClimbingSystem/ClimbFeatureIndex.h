@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BulkData.h"
+#include "ClimbFeatureIndex.generated.h"
+
+UENUM(BlueprintType)
+enum class EClimbFeatureType : uint8
+{
+	Ledge,
+	Pipe,
+	BalanceBeam,
+	NarrowSpace,
+	LedgeWalkEdge
+};
+
+/**
+ * One baked piece of climbable geometry, stored as a segment.
+ * Ledge: top edge of a vertical face, Normal points out of the face, Height is the face height.
+ * LedgeWalkEdge: long top edge of a narrow walkway, Normal points out of the edge, Width is the walkway width.
+ * Pipe: pipe axis, Width is the pipe radius.
+ * BalanceBeam: top center line, Width is the beam width.
+ * NarrowSpace: floor center line of the corridor, Normal points to one wall, Width is the gap between the walls.
+ */
+struct FClimbFeature
+{
+	FVector3f Start;
+	FVector3f End;
+	FVector3f Normal;
+	float Width;
+	float Height;
+	EClimbFeatureType Type;
+
+	/** Field by field, so the baked data does not depend on the struct's layout or padding. */
+	friend FArchive& operator<<(FArchive& Ar, FClimbFeature& Feature)
+	{
+		return Ar << Feature.Start << Feature.End << Feature.Normal << Feature.Width << Feature.Height << Feature.Type;
+	}
+};
+
+/**
+ * Per level index of climbable features, baked offline by UClimbFeatureBakeCommandlet.
+ * The features live in bulk data behind a format version and are bucketed into a uniform grid on load.
+ * Indices of an older format load empty and have to be baked again.
+ */
+UCLASS(BlueprintType)
+class CLIMBINGSYSTEM_API UClimbFeatureIndex : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	void SetFeatures(const TArray<FClimbFeature>& InFeatures);
+#endif
+
+	/** Sweeps a sphere from Start to End against the baked vertical faces of the given type, like a sphere trace would. */
+	bool SweepFeatureFaces(EClimbFeatureType Type, const FVector& Start, const FVector& End, float Radius, FVector& OutLocation, FVector& OutNormal) const;
+
+	/** Gathers the features of the given type whose bounds overlap Bounds. */
+	void QueryFeatures(EClimbFeatureType Type, const FBox& Bounds, TArray<const FClimbFeature*>& OutFeatures) const;
+
+	const TArray<FClimbFeature>& GetFeatures() const { return Features; }
+
+	/** Path the bake commandlet saves the index of a map to, mirroring the map's full package path so maps of the same name do not collide. */
+	static FString GetIndexPackageName(const FString& MapPackageName);
+
+	/** Bump whenever FClimbFeature or its serialization changes. */
+	static constexpr int32 FeatureFormatVersion = 1;
+
+	/** Loads the baked index of the world's map, if there is one. */
+	static UClimbFeatureIndex* LoadForWorld(const UWorld* World);
+
+	UPROPERTY(VisibleAnywhere)
+	int32 FeatureCount = 0;
+
+	UPROPERTY(EditAnywhere)
+	float CellSize = 500;
+
+private:
+	void BuildGrid();
+
+	FIntVector GetCell(const FVector& Location) const;
+
+	FByteBulkData FeatureData;
+
+	TArray<FClimbFeature> Features;
+	TMap<FIntVector, TArray<int32>> Cells;
+};
@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbInputRecording.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbInputRecording, Log, All);
+
+static constexpr uint32 ClimbInputRecordingMagic = 0x434c4952;
+static constexpr uint32 ClimbInputRecordingVersion = 2;
+
+FArchive& operator<<(FArchive& Ar, FClimbInputFrame& Frame)
+{
+	Ar << Frame.DeltaTime;
+	Ar << Frame.MovementInput;
+	Ar << Frame.ControlPitch;
+	Ar << Frame.ControlYaw;
+	Ar << Frame.JumpState;
+	Ar << Frame.Flags;
+	return Ar;
+}
+
+bool FClimbInputRecording::SaveToFile(const FString& Path)
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		UE_LOG(LogClimbInputRecording, Error, TEXT("Cannot write %s"), *Path);
+		return false;
+	}
+
+	Serialize(*Writer);
+
+	return Writer->Close();
+}
+
+bool FClimbInputRecording::LoadFromFile(const FString& Path)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		UE_LOG(LogClimbInputRecording, Error, TEXT("Cannot read %s"), *Path);
+		return false;
+	}
+
+	Serialize(*Reader);
+
+	if (Reader->IsError())
+	{
+		UE_LOG(LogClimbInputRecording, Error, TEXT("%s is not a climb input recording of version %u"), *Path, ClimbInputRecordingVersion);
+		Frames.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+FString FClimbInputRecording::GetRecordingPath(const FString& Name)
+{
+	if (Name.Contains(TEXT("/")) || Name.Contains(TEXT("\\")))
+		return Name;
+
+	return FPaths::ProjectSavedDir() / TEXT("ClimbRecordings") / Name + TEXT(".climbinput");
+}
+
+void FClimbInputRecording::Serialize(FArchive& Ar)
+{
+	uint32 Magic = ClimbInputRecordingMagic;
+	uint32 Version = ClimbInputRecordingVersion;
+	Ar << Magic;
+	Ar << Version;
+
+	if (Magic != ClimbInputRecordingMagic || Version != ClimbInputRecordingVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << StartLocation;
+	Ar << StartRotation;
+	Ar << StartVelocity;
+	Ar << StartClimbState;
+	Ar << StartObstacleLocation;
+	Ar << StartObstacleNormal;
+	Ar << StartFloorLocation;
+	Ar << StartFloorNormal;
+	Ar << RandomSeed;
+
+	//Frames are packed field by field, 22 bytes each, instead of the bulk array of the padded struct
+	int32 NumFrames = Frames.Num();
+	Ar << NumFrames;
+
+	if (Ar.IsLoading())
+	{
+		if (NumFrames < 0 || (int64)NumFrames * 22 > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Frames.SetNum(NumFrames);
+	}
+
+	for (FClimbInputFrame& Frame : Frames)
+	{
+		Ar << Frame;
+	}
+}
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** The input a climb component consumed on one tick. */
+struct FClimbInputFrame
+{
+	enum EFlags : uint8
+	{
+		CrouchPressed = 1 << 0,
+		CrouchReleased = 1 << 1
+	};
+
+	float DeltaTime = 0;
+	FVector2f MovementInput = FVector2f::ZeroVector;
+
+	/** Movement input is relative to the control rotation, so it is part of the input. */
+	float ControlPitch = 0;
+	float ControlYaw = 0;
+
+	uint8 JumpState = 0;
+	uint8 Flags = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FClimbInputFrame& Frame);
+};
+
+/**
+ * Per tick climb input of one character, saved to a small binary file and replayed with the recorded
+ * delta times, so a route plays out the same way every run.
+ */
+struct CLIMBINGSYSTEM_API FClimbInputRecording
+{
+	/** Where the character stood when recording started, replays teleport there first. */
+	FVector StartLocation = FVector::ZeroVector;
+	FRotator StartRotation = FRotator::ZeroRotator;
+	FVector StartVelocity = FVector::ZeroVector;
+
+	/** UClimbState the character was in when recording started, replays set it up before the first frame. */
+	uint8 StartClimbState = 0;
+
+	/** The surfaces the state was following, which its checks blend from. */
+	FVector StartObstacleLocation = FVector::ZeroVector;
+	FVector StartObstacleNormal = FVector::ZeroVector;
+	FVector StartFloorLocation = FVector::ZeroVector;
+	FVector StartFloorNormal = FVector::UpVector;
+
+	/** Seeds the montage selection, so replays pick the same montage variations. */
+	int32 RandomSeed = 0;
+
+	TArray<FClimbInputFrame> Frames;
+
+	bool SaveToFile(const FString& Path);
+	bool LoadFromFile(const FString& Path);
+
+	/** Saved/ClimbRecordings/<Name>.climbinput, unless Name already is a path. */
+	static FString GetRecordingPath(const FString& Name);
+
+private:
+	void Serialize(FArchive& Ar);
+};
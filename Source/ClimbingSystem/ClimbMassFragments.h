@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "IAnimInt.h"
+#include "ClimbMassFragments.generated.h"
+
+class ACharacter;
+
+/** Climb state of a crowd climber, the subset of UClimbState the Mass processor simulates. */
+USTRUCT()
+struct FClimbMassStateFragment : public FMassFragment
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UClimbState ClimbState = UClimbState::Default;
+
+	/** Seconds spent in ClimbState. */
+	float StateTime = 0;
+
+	/** Ledge feature of the level's UClimbFeatureIndex the climber is heading for or climbing. */
+	int32 LedgeIndex = INDEX_NONE;
+};
+
+/** Same meaning as the UClimbComponent members, so they can be handed over on promotion. */
+USTRUCT()
+struct FClimbMassObstacleFragment : public FMassFragment
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FVector ObstacleLocation = FVector::ZeroVector;
+	FVector ObstacleNormalDir = FVector::ZeroVector;
+	FRotator ClimbingRotation = FRotator::ZeroRotator;
+};
+
+/** The full character standing in for the entity while it is close to a player. */
+USTRUCT()
+struct FClimbMassActorFragment : public FMassFragment
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	TWeakObjectPtr<ACharacter> Character;
+};
+
+/** Set while the entity is promoted, the climbing processor leaves these entities to their character. */
+USTRUCT()
+struct FClimbMassPromotedTag : public FMassTag
+{
+	GENERATED_USTRUCT_BODY()
+};
+
+USTRUCT()
+struct FClimbMassParameters : public FMassSharedFragment
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Same speeds the climb component gives the movement component in each state. */
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float WalkSpeed = 500;
+
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float ClimbSpeed = 200;
+
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float CapsuleRadius = 42;
+
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float CapsuleHalfHeight = 96;
+
+	/** How far below a ledge the capsule center hangs. */
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float HangingDepth = 100;
+
+	/** Seconds spent hanging before climbing up onto the ledge. */
+	UPROPERTY(EditAnywhere, Category = Movement)
+	float HangingTime = 1;
+
+	/** How far around the climber a new ledge is looked for. */
+	UPROPERTY(EditAnywhere, Category = Detection)
+	float LedgeSearchRadius = 1000;
+
+	/** Seconds between ledge searches of an idle climber. */
+	UPROPERTY(EditAnywhere, Category = Detection)
+	float LedgeSearchInterval = 0.5;
+
+	/** Character spawned for the entity when a player comes closer than PromotionDistance, needs a UClimbComponent. */
+	UPROPERTY(EditAnywhere, Category = Promotion)
+	TSubclassOf<ACharacter> PromotedClass;
+
+	UPROPERTY(EditAnywhere, Category = Promotion)
+	float PromotionDistance = 3000;
+
+	/** Larger than PromotionDistance, so climbers on the boundary do not flip every frame. */
+	UPROPERTY(EditAnywhere, Category = Promotion)
+	float DemotionDistance = 3500;
+};
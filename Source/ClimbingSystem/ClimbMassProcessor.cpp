@@ -0,0 +1,399 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbMassProcessor.h"
+#include "ClimbMassFragments.h"
+#include "ClimbFeatureIndex.h"
+#include "ClimbComponent.h"
+#include "ClimbStats.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Mass Climbing"), STAT_Climb_MassClimbing, STATGROUP_Climbing);
+DECLARE_CYCLE_STAT(TEXT("Mass Promotion"), STAT_Climb_MassPromotion, STATGROUP_Climbing);
+
+//Steps a walkable face may start above the feet, same as the default MaxStepHeight of the movement component
+static constexpr float ClimbMassMaxStepHeight = 45;
+
+static void SetClimbMassState(FClimbMassStateFragment& State, UClimbState ClimbState)
+{
+	State.ClimbState = ClimbState;
+	State.StateTime = 0;
+}
+
+static FVector GetClimbMassLedgePoint(const FClimbFeature& Ledge, const FVector& Location)
+{
+	return FMath::ClosestPointOnSegment(Location, FVector(Ledge.Start), FVector(Ledge.End));
+}
+
+/** Whether the climber can walk straight to the foot of the ledge's face without walking into another baked face. */
+static bool IsClimbMassLedgeReachable(const UClimbFeatureIndex& FeatureIndex, const FVector& Location, const FVector& LedgePoint, const FVector& LedgeNormal, const FClimbMassParameters& Params)
+{
+	//Just above step height, anything lower is stepped over
+	float PathZ = Location.Z - Params.CapsuleHalfHeight + ClimbMassMaxStepHeight + 1;
+
+	FVector PathStart(Location.X, Location.Y, PathZ);
+	FVector PathEnd = LedgePoint + LedgeNormal * Params.CapsuleRadius;
+	PathEnd.Z = PathZ;
+
+	//Stop short of touching the ledge's own face, any face hit before that is in the way
+	FVector Path = PathEnd - PathStart;
+	float PathLength = Path.Size2D();
+	if (PathLength <= 1)
+		return true;
+
+	PathEnd -= Path / PathLength;
+
+	FVector BlockLocation;
+	FVector BlockNormal;
+	return !FeatureIndex.SweepFeatureFaces(EClimbFeatureType::Ledge, PathStart, PathEnd, Params.CapsuleRadius, BlockLocation, BlockNormal);
+}
+
+/** Closest ledge above the climber whose face starts at its feet, faces it and can be walked to, or INDEX_NONE. */
+static int32 FindClimbMassLedge(const UClimbFeatureIndex& FeatureIndex, const FVector& Location, const FClimbMassParameters& Params, TArray<const FClimbFeature*>& Ledges)
+{
+	Ledges.Reset();
+	FeatureIndex.QueryFeatures(EClimbFeatureType::Ledge, FBox(Location - FVector(Params.LedgeSearchRadius), Location + FVector(Params.LedgeSearchRadius)), Ledges);
+
+	float FootZ = Location.Z - Params.CapsuleHalfHeight;
+
+	const FClimbFeature* BestLedge = nullptr;
+	float BestDistanceSquared = FMath::Square(Params.LedgeSearchRadius);
+
+	for (const FClimbFeature* Ledge : Ledges)
+	{
+		FVector LedgePoint = GetClimbMassLedgePoint(*Ledge, Location);
+
+		if (LedgePoint.Z - Location.Z < Params.CapsuleHalfHeight)
+			continue;
+
+		if (LedgePoint.Z - Ledge->Height > FootZ + ClimbMassMaxStepHeight)
+			continue;
+
+		if (FVector::DotProduct(Location - LedgePoint, FVector(Ledge->Normal)) <= 0)
+			continue;
+
+		float DistanceSquared = FVector::DistSquared2D(Location, LedgePoint);
+		if (DistanceSquared < BestDistanceSquared && IsClimbMassLedgeReachable(FeatureIndex, Location, LedgePoint, FVector(Ledge->Normal), Params))
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestLedge = Ledge;
+		}
+	}
+
+	return BestLedge ? (int32)(BestLedge - FeatureIndex.GetFeatures().GetData()) : INDEX_NONE;
+}
+
+UClimbMassClimbingProcessor::UClimbMassClimbingProcessor()
+	: EntityQuery(*this)
+{
+	//The crowd is simulated by the authority only, clients see it through the promoted characters
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Server);
+	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Movement;
+}
+
+void UClimbMassClimbingProcessor::Initialize(UObject& Owner)
+{
+	Super::Initialize(Owner);
+
+	FeatureIndex = UClimbFeatureIndex::LoadForWorld(Owner.GetWorld());
+}
+
+void UClimbMassClimbingProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FClimbMassStateFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FClimbMassObstacleFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FClimbMassParameters>();
+	EntityQuery.AddTagRequirement<FClimbMassPromotedTag>(EMassFragmentPresence::None);
+}
+
+void UClimbMassClimbingProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_MassClimbing);
+
+	//Without baked ledges there is nothing to climb
+	if (FeatureIndex == nullptr)
+		return;
+
+	const UClimbFeatureIndex& Index = *FeatureIndex;
+	const TArray<FClimbFeature>& Features = Index.GetFeatures();
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [&Index, &Features](FMassExecutionContext& Context)
+	{
+		const int32 NumEntities = Context.GetNumEntities();
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+		const FClimbMassParameters& Params = Context.GetConstSharedFragment<FClimbMassParameters>();
+		const TArrayView<FTransformFragment> Transforms = Context.GetMutableFragmentView<FTransformFragment>();
+		const TArrayView<FClimbMassStateFragment> States = Context.GetMutableFragmentView<FClimbMassStateFragment>();
+		const TArrayView<FClimbMassObstacleFragment> Obstacles = Context.GetMutableFragmentView<FClimbMassObstacleFragment>();
+
+		TArray<const FClimbFeature*> Ledges;
+
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; EntityIndex++)
+		{
+			FTransform& Transform = Transforms[EntityIndex].GetMutableTransform();
+			FClimbMassStateFragment& State = States[EntityIndex];
+			FClimbMassObstacleFragment& Obstacle = Obstacles[EntityIndex];
+
+			FVector Location = Transform.GetLocation();
+			State.StateTime += DeltaTime;
+
+			if (State.LedgeIndex != INDEX_NONE && !Features.IsValidIndex(State.LedgeIndex))
+			{
+				State.LedgeIndex = INDEX_NONE;
+				SetClimbMassState(State, UClimbState::Default);
+			}
+
+			switch (State.ClimbState)
+			{
+			case UClimbState::Default:
+			{
+				if (State.LedgeIndex == INDEX_NONE)
+				{
+					if (State.StateTime < Params.LedgeSearchInterval)
+						break;
+
+					State.StateTime = 0;
+					State.LedgeIndex = FindClimbMassLedge(Index, Location, Params, Ledges);
+					if (State.LedgeIndex == INDEX_NONE)
+						break;
+				}
+
+				const FClimbFeature& Ledge = Features[State.LedgeIndex];
+				FVector LedgePoint = GetClimbMassLedgePoint(Ledge, Location);
+				FVector LedgeNormal = FVector(Ledge.Normal);
+
+				//Walk to the foot of the face, staying at the current height
+				FVector WallLocation = LedgePoint + LedgeNormal * Params.CapsuleRadius;
+				WallLocation.Z = Location.Z;
+
+				FVector ToWall = WallLocation - Location;
+				float WallDistance = ToWall.Size2D();
+				float WalkDistance = Params.WalkSpeed * DeltaTime;
+
+				if (WallDistance > WalkDistance)
+				{
+					Transform.SetLocation(Location + ToWall / WallDistance * WalkDistance);
+					Transform.SetRotation(FRotator(0, ToWall.Rotation().Yaw, 0).Quaternion());
+					break;
+				}
+
+				Obstacle.ObstacleLocation = FVector(LedgePoint.X, LedgePoint.Y, Location.Z);
+				Obstacle.ObstacleNormalDir = LedgeNormal;
+				Obstacle.ClimbingRotation = FRotator(0, (-LedgeNormal).Rotation().Yaw, 0);
+
+				Transform.SetLocation(WallLocation);
+				Transform.SetRotation(Obstacle.ClimbingRotation.Quaternion());
+
+				SetClimbMassState(State, UClimbState::Climbing);
+				break;
+			}
+			case UClimbState::Climbing:
+			{
+				if (State.LedgeIndex == INDEX_NONE)
+				{
+					SetClimbMassState(State, UClimbState::Default);
+					break;
+				}
+
+				FVector LedgePoint = GetClimbMassLedgePoint(Features[State.LedgeIndex], Location);
+				float HangingZ = LedgePoint.Z - Params.HangingDepth;
+
+				Location.Z = FMath::Min(Location.Z + Params.ClimbSpeed * DeltaTime, HangingZ);
+				Transform.SetLocation(Location);
+
+				Obstacle.ObstacleLocation = FVector(LedgePoint.X, LedgePoint.Y, Location.Z);
+
+				if (Location.Z >= HangingZ)
+				{
+					Obstacle.ObstacleLocation = LedgePoint;
+					SetClimbMassState(State, UClimbState::Hanging);
+				}
+				break;
+			}
+			case UClimbState::Hanging:
+			{
+				if (State.StateTime < Params.HangingTime)
+					break;
+
+				//Climb up onto the ledge, ObstacleLocation is the point on the edge
+				FVector TopLocation = Obstacle.ObstacleLocation - Obstacle.ObstacleNormalDir * Params.CapsuleRadius * 2 + FVector::UpVector * Params.CapsuleHalfHeight;
+				Transform.SetLocation(TopLocation);
+
+				State.LedgeIndex = INDEX_NONE;
+				SetClimbMassState(State, UClimbState::Default);
+				break;
+			}
+			default:
+				//States the crowd does not simulate start over from the default state
+				State.LedgeIndex = INDEX_NONE;
+				SetClimbMassState(State, UClimbState::Default);
+				break;
+			}
+		}
+	});
+}
+
+UClimbMassPromotionProcessor::UClimbMassPromotionProcessor()
+	: PromoteQuery(*this)
+	, DemoteQuery(*this)
+{
+	//Promoted characters are spawned by the authority and replicate to clients like any other character
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Server);
+	ExecutionOrder.ExecuteAfter.Add(UClimbMassClimbingProcessor::StaticClass()->GetFName());
+	bRequiresGameThreadExecution = true;
+}
+
+ACharacter* UClimbMassPromotionProcessor::PromoteEntity(UWorld* World, const FClimbMassParameters& Params, const FTransform& Transform, const FClimbMassStateFragment& State, const FClimbMassObstacleFragment& Obstacle)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ACharacter* Character = World->SpawnActor<ACharacter>(Params.PromotedClass, Transform.GetLocation(), Transform.Rotator(), SpawnParameters);
+	if (Character == nullptr)
+		return nullptr;
+
+	if (Character->GetController() == nullptr)
+		Character->SpawnDefaultController();
+
+	if (UClimbComponent* ClimbComponent = Character->FindComponentByClass<UClimbComponent>())
+	{
+		ClimbComponent->ResumeClimb(State.ClimbState, Obstacle.ObstacleLocation, Obstacle.ObstacleNormalDir);
+	}
+
+	return Character;
+}
+
+void UClimbMassPromotionProcessor::ConfigureQueries()
+{
+	PromoteQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	PromoteQuery.AddRequirement<FClimbMassStateFragment>(EMassFragmentAccess::ReadOnly);
+	PromoteQuery.AddRequirement<FClimbMassObstacleFragment>(EMassFragmentAccess::ReadOnly);
+	PromoteQuery.AddRequirement<FClimbMassActorFragment>(EMassFragmentAccess::ReadWrite);
+	PromoteQuery.AddConstSharedRequirement<FClimbMassParameters>();
+	PromoteQuery.AddTagRequirement<FClimbMassPromotedTag>(EMassFragmentPresence::None);
+
+	DemoteQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+	DemoteQuery.AddRequirement<FClimbMassStateFragment>(EMassFragmentAccess::ReadWrite);
+	DemoteQuery.AddRequirement<FClimbMassActorFragment>(EMassFragmentAccess::ReadWrite);
+	DemoteQuery.AddConstSharedRequirement<FClimbMassParameters>();
+	DemoteQuery.AddTagRequirement<FClimbMassPromotedTag>(EMassFragmentPresence::All);
+}
+
+void UClimbMassPromotionProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_MassPromotion);
+
+	UWorld* World = EntityManager.GetWorld();
+	if (World == nullptr)
+		return;
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr)
+			continue;
+
+		//The server does not update remote players' cameras, their view target stands in for them
+		if (PlayerController->IsLocalController() && PlayerController->PlayerCameraManager != nullptr)
+			ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+		else if (AActor* ViewTarget = PlayerController->GetViewTarget())
+			ViewLocations.Add(ViewTarget->GetActorLocation());
+		else if (APawn* Pawn = PlayerController->GetPawn())
+			ViewLocations.Add(Pawn->GetActorLocation());
+	}
+
+	auto GetViewDistanceSquared = [&ViewLocations](const FVector& Location)
+	{
+		double DistanceSquared = MAX_dbl;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(ViewLocation, Location));
+		}
+		return DistanceSquared;
+	};
+
+	PromoteQuery.ForEachEntityChunk(EntityManager, Context, [World, &GetViewDistanceSquared](FMassExecutionContext& Context)
+	{
+		const FClimbMassParameters& Params = Context.GetConstSharedFragment<FClimbMassParameters>();
+		if (Params.PromotedClass == nullptr)
+			return;
+
+		const int32 NumEntities = Context.GetNumEntities();
+		const double PromotionDistanceSquared = FMath::Square(Params.PromotionDistance);
+
+		const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FClimbMassStateFragment> States = Context.GetFragmentView<FClimbMassStateFragment>();
+		const TConstArrayView<FClimbMassObstacleFragment> Obstacles = Context.GetFragmentView<FClimbMassObstacleFragment>();
+		const TArrayView<FClimbMassActorFragment> Actors = Context.GetMutableFragmentView<FClimbMassActorFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; EntityIndex++)
+		{
+			const FTransform& Transform = Transforms[EntityIndex].GetTransform();
+			if (GetViewDistanceSquared(Transform.GetLocation()) > PromotionDistanceSquared)
+				continue;
+
+			ACharacter* Character = PromoteEntity(World, Params, Transform, States[EntityIndex], Obstacles[EntityIndex]);
+			if (Character == nullptr)
+				continue;
+
+			Actors[EntityIndex].Character = Character;
+			Context.Defer().AddTag<FClimbMassPromotedTag>(Context.GetEntity(EntityIndex));
+		}
+	});
+
+	DemoteQuery.ForEachEntityChunk(EntityManager, Context, [&GetViewDistanceSquared](FMassExecutionContext& Context)
+	{
+		const FClimbMassParameters& Params = Context.GetConstSharedFragment<FClimbMassParameters>();
+
+		const int32 NumEntities = Context.GetNumEntities();
+		const double DemotionDistanceSquared = FMath::Square(Params.DemotionDistance);
+
+		const TArrayView<FTransformFragment> Transforms = Context.GetMutableFragmentView<FTransformFragment>();
+		const TArrayView<FClimbMassStateFragment> States = Context.GetMutableFragmentView<FClimbMassStateFragment>();
+		const TArrayView<FClimbMassActorFragment> Actors = Context.GetMutableFragmentView<FClimbMassActorFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; EntityIndex++)
+		{
+			FTransform& Transform = Transforms[EntityIndex].GetMutableTransform();
+			ACharacter* Character = Actors[EntityIndex].Character.Get();
+
+			//Destroyed by gameplay, the crowd carries on from where the character was last seen
+			if (Character == nullptr)
+			{
+				Context.Defer().RemoveTag<FClimbMassPromotedTag>(Context.GetEntity(EntityIndex));
+				continue;
+			}
+
+			//Keep the entity on the character, so it is in the right place if it gets demoted
+			Transform.SetLocation(Character->GetActorLocation());
+			Transform.SetRotation(FRotator(0, Character->GetActorRotation().Yaw, 0).Quaternion());
+
+			if (GetViewDistanceSquared(Transform.GetLocation()) <= DemotionDistanceSquared)
+				continue;
+
+			UClimbComponent* ClimbComponent = Character->FindComponentByClass<UClimbComponent>();
+			if (ClimbComponent != nullptr && !ClimbComponent->CanHandOffToCrowd())
+				continue;
+
+			FClimbMassStateFragment& State = States[EntityIndex];
+			State.LedgeIndex = INDEX_NONE;
+			SetClimbMassState(State, UClimbState::Default);
+
+			AController* Controller = Character->GetController();
+			if (Controller != nullptr && !Controller->IsPlayerController())
+				Controller->Destroy();
+
+			Character->Destroy();
+			Actors[EntityIndex].Character.Reset();
+			Context.Defer().RemoveTag<FClimbMassPromotedTag>(Context.GetEntity(EntityIndex));
+		}
+	});
+}
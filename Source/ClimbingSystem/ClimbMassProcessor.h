@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "ClimbMassProcessor.generated.h"
+
+class ACharacter;
+class UClimbFeatureIndex;
+struct FClimbMassParameters;
+struct FClimbMassStateFragment;
+struct FClimbMassObstacleFragment;
+
+/**
+ * Simulates crowd climbers in parallel chunks: walk to a baked ledge, climb its face, hang and climb up onto it.
+ * Works against the level's UClimbFeatureIndex only, without traces, montages or a character movement component.
+ * Ledges behind another baked face are skipped, but the ground is not known to the index: the walk to a ledge is a
+ * straight line at constant height that assumes open, level floor, so gaps, slopes and unbaked obstacles are walked through.
+ * Runs in standalone games and on servers only, clients never simulate or promote crowd climbers.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbMassClimbingProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UClimbMassClimbingProcessor();
+
+protected:
+	virtual void Initialize(UObject& Owner) override;
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	UPROPERTY(Transient)
+	UClimbFeatureIndex* FeatureIndex = nullptr;
+
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Swaps crowd climbers close to a player for a full character with a UClimbComponent, and back once they are far
+ * away again and walking. Spawns actors, so it runs on the game thread after UClimbMassClimbingProcessor.
+ * Only the authority spawns them, so a listen or dedicated server considers every player's view target.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbMassPromotionProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UClimbMassPromotionProcessor();
+
+	/** Spawns the character of an entity at its transform and hands its climb state over, nullptr when it could not be spawned. */
+	static ACharacter* PromoteEntity(UWorld* World, const FClimbMassParameters& Params, const FTransform& Transform, const FClimbMassStateFragment& State, const FClimbMassObstacleFragment& Obstacle);
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery PromoteQuery;
+	FMassEntityQuery DemoteQuery;
+};
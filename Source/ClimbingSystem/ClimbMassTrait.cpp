@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbMassTrait.h"
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+void UClimbMassTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+
+	BuildContext.RequireFragment<FTransformFragment>();
+
+	BuildContext.AddFragment<FClimbMassStateFragment>();
+	BuildContext.AddFragment<FClimbMassObstacleFragment>();
+	BuildContext.AddFragment<FClimbMassActorFragment>();
+
+	const FConstSharedStruct ParametersFragment = EntityManager.GetOrCreateConstSharedFragment(Parameters);
+	BuildContext.AddConstSharedFragment(ParametersFragment);
+}
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "ClimbMassFragments.h"
+#include "ClimbMassTrait.generated.h"
+
+/**
+ * Makes the entities of a Mass entity config crowd climbers, simulated by UClimbMassClimbingProcessor
+ * against the level's baked ledges and promoted to Parameters.PromotedClass near players.
+ */
+UCLASS(meta = (DisplayName = "Climbing"))
+class CLIMBINGSYSTEM_API UClimbMassTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing")
+	FClimbMassParameters Parameters;
+};
@@ -2,219 +2,357 @@
 
 
 #include "ClimbMontageAnimConfig.h"
+#include "ClimbStats.h"
 
-bool UClimbMontageAnimConfig::GetMontagePlayInofoByClimbAction(UClimbAction ClimbAction, FMontagePlayInofo& outMontagePlayInofo)
+void UClimbMontageAnimConfig::PostInitProperties()
 {
-	FMontagePlayInofo MontagePlayInofo;
-
-	TArray<FMontagePlayInofo> MontagePlayInofoList;
-
-	switch (ClimbAction)
-	{
-	case UClimbAction::ClimbingAction_FallToClimbing:
-		MontagePlayInofoList = ClimbingActionFallToClimbing;
-		break;
-	case UClimbAction::ClimbingAction_ClimbUpLand:
-		MontagePlayInofoList = ClimbingActionClimbUpLand;
-		break;
-	case UClimbAction::ClimbingAction_JumpUp:
-		MontagePlayInofoList = ClimbingActionJumpUp;
-		break;
-	case UClimbAction::ClimbingAction_JumpDown:
-		MontagePlayInofoList = ClimbingActionJumpDown;
-		break;
-	case UClimbAction::ClimbingAction_LandDown:
-		MontagePlayInofoList = ClimbingActionLandDown;
-		break;
-	case UClimbAction::ClimbingAction_LeftJump:
-		MontagePlayInofoList = ClimbingActionLeftJump;
-		break;
-	case UClimbAction::ClimbingAction_SuperLeftJump:
-		MontagePlayInofoList = ClimbingActionSuperLeftJump;
-		break;
-	case UClimbAction::ClimbingAction_RightJump:
-		MontagePlayInofoList = ClimbingActionRightJump;
-		break;
-	case UClimbAction::ClimbingAction_SuperRightJump:
-		MontagePlayInofoList = ClimbingActionSuperRightJump;
-		break;
-	case UClimbAction::ClimbingAction_InnerLeft:
-		MontagePlayInofoList = ClimbingActionInnerLeft;
-		break;
-	case UClimbAction::ClimbingAction_InnerRight:
-		MontagePlayInofoList = ClimbingActionInnerRight;
-		break;
-	case UClimbAction::ClimbingAction_OuterLeft:
-		MontagePlayInofoList = ClimbingActionOuterLeft;
-		break;
-	case UClimbAction::ClimbingAction_OuterRight:
-		MontagePlayInofoList = ClimbingActionOuterRight;
-		break;
-	case UClimbAction::ClimbingAction_UpVault:
-		MontagePlayInofoList = ClimbingActionUpVault;
-		break;
-	case UClimbAction::ClimbingAction_UpTurnVault:
-		MontagePlayInofoList = ClimbingActionUpTurnVault;
-		break;
-	case UClimbAction::ClimbingAction_ClimbingToHanging:
-		MontagePlayInofoList = ClimbingActionClimbingToHanging;
-		break;
-	case UClimbAction::ClimbAction_Climb220:
-		MontagePlayInofoList = ClimbActionClimb220;
-		break;
-	case UClimbAction::ClimbAction_Climb100:
-		MontagePlayInofoList = ClimbActionClimb100;
-		break;
-	case UClimbAction::ClimbAction_Vault220:
-		MontagePlayInofoList = ClimbActionVault220;
-		break;
-	case UClimbAction::ClimbAction_Vault100:
-		MontagePlayInofoList = ClimbActionVault100;
-		break;
-	case UClimbAction::ClimbAction_VaultTurn220:
-		MontagePlayInofoList = ClimbActionVaultTurn220;
-		break;
-	case UClimbAction::ClimbAction_VaultTurn100:
-		MontagePlayInofoList = ClimbActionVaultTurn100;
-		break;
-	case UClimbAction::ClimbPipeAction_StartClimbPipe:
-		MontagePlayInofoList = ClimbPipeStartClimbPipe;
-		break;
-	case UClimbAction::ClimbPipeAction_ClimbUpLand:
-		MontagePlayInofoList = ClimbPipeClimbUpLand;
-		break;
-	case UClimbAction::ClimbPipeAction_LandDown:
-		MontagePlayInofoList = ClimbPipeLandDown;
-		break;
-	case UClimbAction::ClimbPipeAction_LeftJump:
-		MontagePlayInofoList = ClimbPipeLeftJump;
-		break;
-	case UClimbAction::ClimbPipeAction_RightJump:
-		MontagePlayInofoList = ClimbPipeRightJump;
-		break;
-	case UClimbAction::Hanging_AttachHanging:
-		MontagePlayInofoList = HangingAttachHanging;
-		break;
-	case UClimbAction::Hanging_InnerLeft:
-		MontagePlayInofoList = HangingInnerLeft;
-		break;
-	case UClimbAction::Hanging_InnerRight:
-		MontagePlayInofoList = HangingInnerRight;
-		break;
-	case UClimbAction::Hanging_OuterLeft:
-		MontagePlayInofoList = HangingOuterLeft;
-		break;
-	case UClimbAction::Hanging_OuterRight:
-		MontagePlayInofoList = HangingOuterRight;
-		break;
-	case UClimbAction::Hanging_ClimbUp:
-		MontagePlayInofoList = HangingClimbUp;
-		break;
-	case UClimbAction::Hanging_Turn:
-		MontagePlayInofoList = HangingTurn;
-		break;
-	case UClimbAction::Hanging_Drop:
-		MontagePlayInofoList = HangingDrop;
-		break;
-	case UClimbAction::FallToLand_Roll:
-		MontagePlayInofoList = FallToLandRoll;
-		break;
-	case UClimbAction::FallToLand_Front:
-		MontagePlayInofoList = FallToLandFront;
-		break;
-	case UClimbAction::FallToLand_LandingGround:
-		MontagePlayInofoList = FallToLandLandingGround;
-		break;
-	case UClimbAction::Walk_Slider:
-		MontagePlayInofoList = WalkSlider;
-		break;
-	case UClimbAction::Walk_WalkToBalance:
-		MontagePlayInofoList = WalkToBalance;
-		break;
-	case UClimbAction::Walk_WalkToNarrowSpace:
-		MontagePlayInofoList = WalkToNarrowSpace;
-		break;
-	case UClimbAction::Walk_WalkToLedgeWalkRight:
-		MontagePlayInofoList = WalkToLedgeWalkRight;
-		break;
-	case UClimbAction::Walk_WalkToLedgeWalkLeft:
-		MontagePlayInofoList = WalkToLedgeWalkLeft;
-		break;
-	case UClimbAction::Walk_WalkToZipLine:
-		MontagePlayInofoList = WalkToZipLine;
-		break;
-	case UClimbAction::Balance_BalanceUpToWalk:
-		MontagePlayInofoList = BalanceUpToWalk;
-		break;
-	case UClimbAction::Balance_BalanceDownToWalk:
-		MontagePlayInofoList = BalanceDownToWalk;
-		break;
-	case UClimbAction::Balance_BalanceTurnBack:
-		MontagePlayInofoList = BalanceTurnBack;
-		break;
-	case UClimbAction::NarrowSpace_NarrowSpaceUpToWalk:
-		MontagePlayInofoList = NarrowSpaceUpToWalk;
-		break;
-	case UClimbAction::NarrowSpace_NarrowSpaceDownToWalk:
-		MontagePlayInofoList = NarrowSpaceDownToWalk;
-		break;
-	case UClimbAction::LedgeWalkRight_UpInsideCorner:
-		MontagePlayInofoList = LedgeWalkRightUpInsideCorner;
-		break;
-	case UClimbAction::LedgeWalkRight_DownInsideCorner:
-		MontagePlayInofoList = LedgeWalkRightDownInsideCorner;
-		break;
-	case UClimbAction::LedgeWalkRight_UpOutwardCorner:
-		MontagePlayInofoList = LedgeWalkRightUpOutwardCorner;
-		break;
-	case UClimbAction::LedgeWalkRight_DownOutwardCorner:
-		MontagePlayInofoList = LedgeWalkRightDownOutwardCorner;
-		break;
-	case UClimbAction::LedgeWalkRight_UpLedgeWalkToWalk:
-		MontagePlayInofoList = LedgeWalkRightUpLedgeWalkToWalk;
-		break;
-	case UClimbAction::LedgeWalkRight_DownLedgeWalkToWalk:
-		MontagePlayInofoList = LedgeWalkRightDownLedgeWalkToWalk;
-		break;
-	case UClimbAction::LedgeWalkLeft_UpInsideCorner:
-		MontagePlayInofoList = LedgeWalkLeftUpInsideCorner;
-		break;
-	case UClimbAction::LedgeWalkLeft_DownInsideCorner:
-		MontagePlayInofoList = LedgeWalkLeftDownInsideCorner;
-		break;
-	case UClimbAction::LedgeWalkLeft_UpOutwardCorner:
-		MontagePlayInofoList = LedgeWalkLeftUpOutwardCorner;
-		break;
-	case UClimbAction::LedgeWalkLeft_DownOutwardCorner:
-		MontagePlayInofoList = LedgeWalkLeftDownOutwardCorner;
-		break;
-	case UClimbAction::LedgeWalkLeft_UpLedgeWalkToWalk:
-		MontagePlayInofoList = LedgeWalkLeftUpLedgeWalkToWalk;
-		break;
-	case UClimbAction::LedgeWalkLeft_DownLedgeWalkToWalk:
-		MontagePlayInofoList = LedgeWalkLeftDownLedgeWalkToWalk;
-		break;
-	case UClimbAction::ZipLine_ZipLineGlidingToWalk:
-		MontagePlayInofoList = ZipLineGlidingToWalk;
-		break;
-	case UClimbAction::ZipLine_RightFallToZipLine:
-		MontagePlayInofoList = RightFallToZipLine;
-		break;
-	case UClimbAction::ZipLine_LeftFallToZipLine:
-		MontagePlayInofoList = LeftFallToZipLine;
-		break;
-	default:
-		break;
-	}
-	
+	Super::PostInitProperties();
+
+	BuildMontageTable();
+}
+
+void UClimbMontageAnimConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildMontageTable();
+}
+
+const FMontagePlayInofo* UClimbMontageAnimConfig::GetMontagePlayInofoByClimbAction(UClimbAction ClimbAction, const FRandomStream& RandomStream) const
+{
+	INC_DWORD_STAT(STAT_ClimbMontageLookups);
+
+	TConstArrayView<FMontagePlayInofo> MontagePlayInofoList = GetMontagePlayInofoList(ClimbAction);
+
 	if(MontagePlayInofoList.Num() == 0)
 	{	
-		return false;
+		return nullptr;
+	}
+
+	int RandomIndex = RandomStream.RandRange(0, MontagePlayInofoList.Num() - 1);
+
+	return &MontagePlayInofoList[RandomIndex];
+}
+
+TConstArrayView<FMontagePlayInofo> UClimbMontageAnimConfig::GetMontagePlayInofoList(UClimbAction ClimbAction) const
+{
+	int32 ActionIndex = (int32)ClimbAction;
+
+	if (ActionIndex >= ClimbActionCount || MontageTable[ActionIndex] == nullptr)
+	{
+		return TConstArrayView<FMontagePlayInofo>();
+	}
+
+	return *MontageTable[ActionIndex];
+}
+
+void UClimbMontageAnimConfig::GetClimbActionMontages(TConstArrayView<UClimbAction> ClimbActions, TArray<FSoftObjectPath>& OutMontages) const
+{
+	for (UClimbAction ClimbAction : ClimbActions)
+	{
+		for (const FMontagePlayInofo& MontagePlayInofo : GetMontagePlayInofoList(ClimbAction))
+		{
+			if (!MontagePlayInofo.AnimMontageToPlay.IsNull())
+			{
+				OutMontages.AddUnique(MontagePlayInofo.AnimMontageToPlay.ToSoftObjectPath());
+			}
+		}
+	}
+}
+
+void UClimbMontageAnimConfig::GetClimbStateMontages(UClimbState ClimbState, TArray<FSoftObjectPath>& OutMontages) const
+{
+	GetClimbActionMontages(GetClimbStateActions(ClimbState), OutMontages);
+
+	for (UClimbState ReachableState : GetReachableClimbStates(ClimbState))
+	{
+		GetClimbActionMontages(GetClimbStateExitActions(ReachableState), OutMontages);
+	}
+}
+
+TConstArrayView<UClimbAction> UClimbMontageAnimConfig::GetClimbStateActions(UClimbState ClimbState)
+{
+	static const UClimbAction DefaultActions[] =
+	{
+		UClimbAction::ClimbingAction_FallToClimbing,
+		UClimbAction::ClimbAction_Climb220,
+		UClimbAction::ClimbAction_Climb100,
+		UClimbAction::ClimbAction_Vault220,
+		UClimbAction::ClimbAction_Vault100,
+		UClimbAction::ClimbAction_VaultTurn220,
+		UClimbAction::ClimbAction_VaultTurn100,
+		UClimbAction::ClimbPipeAction_StartClimbPipe,
+		UClimbAction::Hanging_AttachHanging,
+		UClimbAction::FallToLand_Roll,
+		UClimbAction::FallToLand_Front,
+		UClimbAction::FallToLand_LandingGround,
+		UClimbAction::Walk_Slider,
+		UClimbAction::Walk_WalkToBalance,
+		UClimbAction::Walk_WalkToNarrowSpace,
+		UClimbAction::Walk_WalkToLedgeWalkRight,
+		UClimbAction::Walk_WalkToLedgeWalkLeft,
+		UClimbAction::Walk_WalkToZipLine,
+		UClimbAction::ZipLine_RightFallToZipLine,
+		UClimbAction::ZipLine_LeftFallToZipLine
+	};
+
+	static const UClimbAction ClimbingActions[] =
+	{
+		UClimbAction::ClimbingAction_ClimbUpLand,
+		UClimbAction::ClimbingAction_JumpUp,
+		UClimbAction::ClimbingAction_JumpDown,
+		UClimbAction::ClimbingAction_LandDown,
+		UClimbAction::ClimbingAction_LeftJump,
+		UClimbAction::ClimbingAction_SuperLeftJump,
+		UClimbAction::ClimbingAction_RightJump,
+		UClimbAction::ClimbingAction_SuperRightJump,
+		UClimbAction::ClimbingAction_InnerLeft,
+		UClimbAction::ClimbingAction_InnerRight,
+		UClimbAction::ClimbingAction_OuterLeft,
+		UClimbAction::ClimbingAction_OuterRight,
+		UClimbAction::ClimbingAction_UpVault,
+		UClimbAction::ClimbingAction_UpTurnVault,
+		UClimbAction::ClimbingAction_ClimbingToHanging
+	};
+
+	static const UClimbAction ClimbingPipeActions[] =
+	{
+		UClimbAction::ClimbPipeAction_ClimbUpLand,
+		UClimbAction::ClimbPipeAction_LandDown,
+		UClimbAction::ClimbPipeAction_LeftJump,
+		UClimbAction::ClimbPipeAction_RightJump
+	};
+
+	static const UClimbAction HangingActions[] =
+	{
+		UClimbAction::Hanging_InnerLeft,
+		UClimbAction::Hanging_InnerRight,
+		UClimbAction::Hanging_OuterLeft,
+		UClimbAction::Hanging_OuterRight,
+		UClimbAction::Hanging_ClimbUp,
+		UClimbAction::Hanging_Turn,
+		UClimbAction::Hanging_Drop
+	};
+
+	static const UClimbAction BalanceActions[] =
+	{
+		UClimbAction::Balance_BalanceUpToWalk,
+		UClimbAction::Balance_BalanceDownToWalk,
+		UClimbAction::Balance_BalanceTurnBack
+	};
+
+	static const UClimbAction NarrowSpaceActions[] =
+	{
+		UClimbAction::NarrowSpace_NarrowSpaceUpToWalk,
+		UClimbAction::NarrowSpace_NarrowSpaceDownToWalk
+	};
+
+	//Ledge walk checks pick the right or left variant by the walk direction, so both states share one list
+	static const UClimbAction LedgeWalkActions[] =
+	{
+		UClimbAction::LedgeWalkRight_UpInsideCorner,
+		UClimbAction::LedgeWalkRight_DownInsideCorner,
+		UClimbAction::LedgeWalkRight_UpOutwardCorner,
+		UClimbAction::LedgeWalkRight_DownOutwardCorner,
+		UClimbAction::LedgeWalkRight_UpLedgeWalkToWalk,
+		UClimbAction::LedgeWalkRight_DownLedgeWalkToWalk,
+		UClimbAction::LedgeWalkLeft_UpInsideCorner,
+		UClimbAction::LedgeWalkLeft_DownInsideCorner,
+		UClimbAction::LedgeWalkLeft_UpOutwardCorner,
+		UClimbAction::LedgeWalkLeft_DownOutwardCorner,
+		UClimbAction::LedgeWalkLeft_UpLedgeWalkToWalk,
+		UClimbAction::LedgeWalkLeft_DownLedgeWalkToWalk
+	};
+
+	static const UClimbAction ZipLineActions[] =
+	{
+		UClimbAction::ZipLine_ZipLineGlidingToWalk
+	};
+
+	switch (ClimbState)
+	{
+	case UClimbState::Default:
+		return DefaultActions;
+	case UClimbState::Climbing:
+		return ClimbingActions;
+	case UClimbState::ClimbingPipe:
+		return ClimbingPipeActions;
+	case UClimbState::Hanging:
+		return HangingActions;
+	case UClimbState::Balance:
+		return BalanceActions;
+	case UClimbState::NarrowSpace:
+		return NarrowSpaceActions;
+	case UClimbState::LedgeWalkRight:
+	case UClimbState::LedgeWalkLeft:
+		return LedgeWalkActions;
+	case UClimbState::ZipLine:
+		return ZipLineActions;
+	default:
+		return TConstArrayView<UClimbAction>();
 	}
+}
+
+TConstArrayView<UClimbAction> UClimbMontageAnimConfig::GetClimbStateExitActions(UClimbState ClimbState)
+{
+	static const UClimbAction ClimbingExitActions[] =
+	{
+		UClimbAction::ClimbingAction_ClimbUpLand,
+		UClimbAction::ClimbingAction_LandDown,
+		UClimbAction::ClimbingAction_UpVault,
+		UClimbAction::ClimbingAction_UpTurnVault,
+		UClimbAction::ClimbingAction_ClimbingToHanging
+	};
 
-	int RandomIndex = FMath::RandRange(0, MontagePlayInofoList.Num() - 1);
+	static const UClimbAction ClimbingPipeExitActions[] =
+	{
+		UClimbAction::ClimbPipeAction_ClimbUpLand,
+		UClimbAction::ClimbPipeAction_LandDown
+	};
 
-	outMontagePlayInofo = MontagePlayInofoList[RandomIndex];
+	static const UClimbAction HangingExitActions[] =
+	{
+		UClimbAction::Hanging_ClimbUp,
+		UClimbAction::Hanging_Drop
+	};
+
+	static const UClimbAction BalanceExitActions[] =
+	{
+		UClimbAction::Balance_BalanceUpToWalk,
+		UClimbAction::Balance_BalanceDownToWalk
+	};
 
-	return true;
+	static const UClimbAction LedgeWalkExitActions[] =
+	{
+		UClimbAction::LedgeWalkRight_UpLedgeWalkToWalk,
+		UClimbAction::LedgeWalkRight_DownLedgeWalkToWalk,
+		UClimbAction::LedgeWalkLeft_UpLedgeWalkToWalk,
+		UClimbAction::LedgeWalkLeft_DownLedgeWalkToWalk
+	};
+
+	switch (ClimbState)
+	{
+	case UClimbState::Climbing:
+		return ClimbingExitActions;
+	case UClimbState::ClimbingPipe:
+		return ClimbingPipeExitActions;
+	case UClimbState::Hanging:
+		return HangingExitActions;
+	case UClimbState::Balance:
+		return BalanceExitActions;
+	case UClimbState::LedgeWalkRight:
+	case UClimbState::LedgeWalkLeft:
+		return LedgeWalkExitActions;
+	//Every action of these leaves the state
+	case UClimbState::NarrowSpace:
+	case UClimbState::ZipLine:
+		return GetClimbStateActions(ClimbState);
+	//The default state's actions are kept resident by the climb component
+	default:
+		return TConstArrayView<UClimbAction>();
+	}
+}
+
+TConstArrayView<UClimbState> UClimbMontageAnimConfig::GetReachableClimbStates(UClimbState ClimbState)
+{
+	static const UClimbState DefaultReachableStates[] =
+	{
+		UClimbState::Climbing,
+		UClimbState::ClimbingPipe,
+		UClimbState::Hanging,
+		UClimbState::Balance,
+		UClimbState::NarrowSpace,
+		UClimbState::LedgeWalkRight,
+		UClimbState::LedgeWalkLeft,
+		UClimbState::ZipLine
+	};
+
+	static const UClimbState ClimbingReachableStates[] =
+	{
+		UClimbState::Default,
+		UClimbState::Hanging
+	};
+
+	static const UClimbState OtherReachableStates[] =
+	{
+		UClimbState::Default
+	};
+
+	switch (ClimbState)
+	{
+	case UClimbState::Default:
+		return DefaultReachableStates;
+	case UClimbState::Climbing:
+		return ClimbingReachableStates;
+	default:
+		return OtherReachableStates;
+	}
+}
+
+void UClimbMontageAnimConfig::BuildMontageTable()
+{
+	MontageTable[(int32)UClimbAction::ClimbingAction_FallToClimbing] = &ClimbingActionFallToClimbing;
+	MontageTable[(int32)UClimbAction::ClimbingAction_ClimbUpLand] = &ClimbingActionClimbUpLand;
+	MontageTable[(int32)UClimbAction::ClimbingAction_JumpUp] = &ClimbingActionJumpUp;
+	MontageTable[(int32)UClimbAction::ClimbingAction_JumpDown] = &ClimbingActionJumpDown;
+	MontageTable[(int32)UClimbAction::ClimbingAction_LandDown] = &ClimbingActionLandDown;
+	MontageTable[(int32)UClimbAction::ClimbingAction_LeftJump] = &ClimbingActionLeftJump;
+	MontageTable[(int32)UClimbAction::ClimbingAction_SuperLeftJump] = &ClimbingActionSuperLeftJump;
+	MontageTable[(int32)UClimbAction::ClimbingAction_RightJump] = &ClimbingActionRightJump;
+	MontageTable[(int32)UClimbAction::ClimbingAction_SuperRightJump] = &ClimbingActionSuperRightJump;
+	MontageTable[(int32)UClimbAction::ClimbingAction_InnerLeft] = &ClimbingActionInnerLeft;
+	MontageTable[(int32)UClimbAction::ClimbingAction_InnerRight] = &ClimbingActionInnerRight;
+	MontageTable[(int32)UClimbAction::ClimbingAction_OuterLeft] = &ClimbingActionOuterLeft;
+	MontageTable[(int32)UClimbAction::ClimbingAction_OuterRight] = &ClimbingActionOuterRight;
+	MontageTable[(int32)UClimbAction::ClimbingAction_UpVault] = &ClimbingActionUpVault;
+	MontageTable[(int32)UClimbAction::ClimbingAction_UpTurnVault] = &ClimbingActionUpTurnVault;
+	MontageTable[(int32)UClimbAction::ClimbingAction_ClimbingToHanging] = &ClimbingActionClimbingToHanging;
+	MontageTable[(int32)UClimbAction::ClimbAction_Climb220] = &ClimbActionClimb220;
+	MontageTable[(int32)UClimbAction::ClimbAction_Climb100] = &ClimbActionClimb100;
+	MontageTable[(int32)UClimbAction::ClimbAction_Vault220] = &ClimbActionVault220;
+	MontageTable[(int32)UClimbAction::ClimbAction_Vault100] = &ClimbActionVault100;
+	MontageTable[(int32)UClimbAction::ClimbAction_VaultTurn220] = &ClimbActionVaultTurn220;
+	MontageTable[(int32)UClimbAction::ClimbAction_VaultTurn100] = &ClimbActionVaultTurn100;
+	MontageTable[(int32)UClimbAction::ClimbPipeAction_StartClimbPipe] = &ClimbPipeStartClimbPipe;
+	MontageTable[(int32)UClimbAction::ClimbPipeAction_ClimbUpLand] = &ClimbPipeClimbUpLand;
+	MontageTable[(int32)UClimbAction::ClimbPipeAction_LandDown] = &ClimbPipeLandDown;
+	MontageTable[(int32)UClimbAction::ClimbPipeAction_LeftJump] = &ClimbPipeLeftJump;
+	MontageTable[(int32)UClimbAction::ClimbPipeAction_RightJump] = &ClimbPipeRightJump;
+	MontageTable[(int32)UClimbAction::Hanging_AttachHanging] = &HangingAttachHanging;
+	MontageTable[(int32)UClimbAction::Hanging_InnerLeft] = &HangingInnerLeft;
+	MontageTable[(int32)UClimbAction::Hanging_InnerRight] = &HangingInnerRight;
+	MontageTable[(int32)UClimbAction::Hanging_OuterLeft] = &HangingOuterLeft;
+	MontageTable[(int32)UClimbAction::Hanging_OuterRight] = &HangingOuterRight;
+	MontageTable[(int32)UClimbAction::Hanging_ClimbUp] = &HangingClimbUp;
+	MontageTable[(int32)UClimbAction::Hanging_Turn] = &HangingTurn;
+	MontageTable[(int32)UClimbAction::Hanging_Drop] = &HangingDrop;
+	MontageTable[(int32)UClimbAction::FallToLand_Roll] = &FallToLandRoll;
+	MontageTable[(int32)UClimbAction::FallToLand_Front] = &FallToLandFront;
+	MontageTable[(int32)UClimbAction::FallToLand_LandingGround] = &FallToLandLandingGround;
+	MontageTable[(int32)UClimbAction::Walk_Slider] = &WalkSlider;
+	MontageTable[(int32)UClimbAction::Walk_WalkToBalance] = &WalkToBalance;
+	MontageTable[(int32)UClimbAction::Walk_WalkToNarrowSpace] = &WalkToNarrowSpace;
+	MontageTable[(int32)UClimbAction::Walk_WalkToLedgeWalkRight] = &WalkToLedgeWalkRight;
+	MontageTable[(int32)UClimbAction::Walk_WalkToLedgeWalkLeft] = &WalkToLedgeWalkLeft;
+	MontageTable[(int32)UClimbAction::Walk_WalkToZipLine] = &WalkToZipLine;
+	MontageTable[(int32)UClimbAction::Balance_BalanceUpToWalk] = &BalanceUpToWalk;
+	MontageTable[(int32)UClimbAction::Balance_BalanceDownToWalk] = &BalanceDownToWalk;
+	MontageTable[(int32)UClimbAction::Balance_BalanceTurnBack] = &BalanceTurnBack;
+	MontageTable[(int32)UClimbAction::NarrowSpace_NarrowSpaceUpToWalk] = &NarrowSpaceUpToWalk;
+	MontageTable[(int32)UClimbAction::NarrowSpace_NarrowSpaceDownToWalk] = &NarrowSpaceDownToWalk;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_UpInsideCorner] = &LedgeWalkRightUpInsideCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_DownInsideCorner] = &LedgeWalkRightDownInsideCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_UpOutwardCorner] = &LedgeWalkRightUpOutwardCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_DownOutwardCorner] = &LedgeWalkRightDownOutwardCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_UpLedgeWalkToWalk] = &LedgeWalkRightUpLedgeWalkToWalk;
+	MontageTable[(int32)UClimbAction::LedgeWalkRight_DownLedgeWalkToWalk] = &LedgeWalkRightDownLedgeWalkToWalk;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_UpInsideCorner] = &LedgeWalkLeftUpInsideCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_DownInsideCorner] = &LedgeWalkLeftDownInsideCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_UpOutwardCorner] = &LedgeWalkLeftUpOutwardCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_DownOutwardCorner] = &LedgeWalkLeftDownOutwardCorner;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_UpLedgeWalkToWalk] = &LedgeWalkLeftUpLedgeWalkToWalk;
+	MontageTable[(int32)UClimbAction::LedgeWalkLeft_DownLedgeWalkToWalk] = &LedgeWalkLeftDownLedgeWalkToWalk;
+	MontageTable[(int32)UClimbAction::ZipLine_ZipLineGlidingToWalk] = &ZipLineGlidingToWalk;
+	MontageTable[(int32)UClimbAction::ZipLine_RightFallToZipLine] = &RightFallToZipLine;
+	MontageTable[(int32)UClimbAction::ZipLine_LeftFallToZipLine] = &LeftFallToZipLine;
 }
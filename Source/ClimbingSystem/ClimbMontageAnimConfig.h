@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "IAnimInt.h"
 #include "ClimbMontageAnimConfig.generated.h"
 
 USTRUCT(BlueprintType)
@@ -11,8 +12,9 @@ struct FMontagePlayInofo
 {
 	GENERATED_USTRUCT_BODY()
 public:
+	/** Streamed in by the climb component while an action that uses it can be triggered. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	UAnimMontage* AnimMontageToPlay;
+	TSoftObjectPtr<UAnimMontage> AnimMontageToPlay;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FVector2D AnimMontageOffSet;
@@ -287,5 +289,37 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = AnimConfig, meta = (AllowPrivateAccess = "true"))
 	TArray<FMontagePlayInofo> LeftFallToZipLine;
 	
-	bool GetMontagePlayInofoByClimbAction(UClimbAction ClimbAction, FMontagePlayInofo& outMontagePlayInofo);
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+	/** Picks one of the montages configured for the action from RandomStream, nullptr when there are none. */
+	const FMontagePlayInofo* GetMontagePlayInofoByClimbAction(UClimbAction ClimbAction, const FRandomStream& RandomStream) const;
+
+	TConstArrayView<FMontagePlayInofo> GetMontagePlayInofoList(UClimbAction ClimbAction) const;
+
+	/** Collects the montages configured for the actions. */
+	void GetClimbActionMontages(TConstArrayView<UClimbAction> ClimbActions, TArray<FSoftObjectPath>& OutMontages) const;
+
+	/**
+	 * Collects the montages of every action that can be triggered in the state, which includes the transitions into the states reachable
+	 * from it, plus the exit actions of those states so leaving one right after entering it does not wait on a load.
+	 */
+	void GetClimbStateMontages(UClimbState ClimbState, TArray<FSoftObjectPath>& OutMontages) const;
+
+	/** The actions the climb component can trigger while in the state. */
+	static TConstArrayView<UClimbAction> GetClimbStateActions(UClimbState ClimbState);
+
+	/** The actions that leave the state, a subset of GetClimbStateActions. */
+	static TConstArrayView<UClimbAction> GetClimbStateExitActions(UClimbState ClimbState);
+
+	/** The states the climb component can move to straight from the state. */
+	static TConstArrayView<UClimbState> GetReachableClimbStates(UClimbState ClimbState);
+
+	static constexpr int32 ClimbActionCount = (int32)UClimbAction::ZipLine_LeftFallToZipLine + 1;
+
+private:
+	/** Fills MontageTable with the action list members, indexed by UClimbAction. */
+	void BuildMontageTable();
+
+	const TArray<FMontagePlayInofo>* MontageTable[ClimbActionCount] = {};
 };
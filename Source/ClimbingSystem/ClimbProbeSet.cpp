@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbProbeSet.h"
+
+static FClimbProbe MakeProbe(ETraceShape Shape, EClimbProbeOrigin Origin, const FVector& Start, const FVector& End, const FVector& AcceptNormal, UClimbAction Action, UClimbAction MirroredAction)
+{
+	FClimbProbe Probe;
+	Probe.Shape = Shape;
+	Probe.Origin = Origin;
+	Probe.Start = Start;
+	Probe.End = End;
+	Probe.AcceptNormal = AcceptNormal;
+	Probe.Action = Action;
+	Probe.MirroredAction = MirroredAction;
+	return Probe;
+}
+
+static TArray<FClimbProbe> MakeDefaultProbes(EClimbProbeGroup Group)
+{
+	TArray<FClimbProbe> Probes;
+
+	switch (Group)
+	{
+		case EClimbProbeGroup::ClimbSideJump:
+		{
+			FClimbProbe& Jump = Probes.Add_GetRef(MakeProbe(ETraceShape::Sphere, EClimbProbeOrigin::Actor, FVector(0, 200, 0), FVector(150, 200, 0), FVector::BackwardVector,
+				UClimbAction::ClimbingAction_RightJump, UClimbAction::ClimbingAction_LeftJump));
+			Jump.bRequireClearPath = true;
+
+			FClimbProbe& SuperJump = Probes.Add_GetRef(MakeProbe(ETraceShape::Sphere, EClimbProbeOrigin::Actor, FVector(0, 350, 0), FVector(150, 350, 0), FVector::BackwardVector,
+				UClimbAction::ClimbingAction_SuperRightJump, UClimbAction::ClimbingAction_SuperLeftJump));
+			SuperJump.bRequireClearPath = true;
+		}
+		break;
+
+		case EClimbProbeGroup::ClimbCornerInner:
+			Probes.Add(MakeProbe(ETraceShape::Line, EClimbProbeOrigin::Actor, FVector(85, 85, 0), FVector(85, 0, 0), FVector::RightVector,
+				UClimbAction::ClimbingAction_InnerRight, UClimbAction::ClimbingAction_InnerLeft));
+			break;
+
+		case EClimbProbeGroup::ClimbCornerOuter:
+		{
+			FClimbProbe& Outer = Probes.Add_GetRef(MakeProbe(ETraceShape::Line, EClimbProbeOrigin::Actor, FVector::ZeroVector, FVector(0, 5, 0), FVector::LeftVector,
+				UClimbAction::ClimbingAction_OuterRight, UClimbAction::ClimbingAction_OuterLeft));
+			Outer.EndCapsuleOffset = FVector::RightVector;
+		}
+		break;
+
+		case EClimbProbeGroup::HangingCornerInner:
+			Probes.Add(MakeProbe(ETraceShape::Line, EClimbProbeOrigin::HangingTop, FVector(50, 85, 0), FVector(50, 0, 0), FVector::RightVector,
+				UClimbAction::Hanging_InnerRight, UClimbAction::Hanging_InnerLeft));
+			break;
+
+		case EClimbProbeGroup::HangingCornerOuter:
+		{
+			FClimbProbe& Outer = Probes.Add_GetRef(MakeProbe(ETraceShape::Line, EClimbProbeOrigin::HangingTop, FVector(-10, 0, 0), FVector(-10, 5, 0), FVector::LeftVector,
+				UClimbAction::Hanging_OuterRight, UClimbAction::Hanging_OuterLeft));
+			Outer.EndCapsuleOffset = FVector::RightVector;
+		}
+		break;
+	}
+
+	return Probes;
+}
+
+const TArray<FClimbProbe>& UClimbProbeSet::GetProbes(EClimbProbeGroup Group) const
+{
+	if (const FClimbProbeList* ProbeList = Groups.Find(Group))
+		return ProbeList->Probes;
+
+	return GetDefaultProbes(Group);
+}
+
+const TArray<FClimbProbe>& UClimbProbeSet::GetDefaultProbes(EClimbProbeGroup Group)
+{
+	static const TArray<FClimbProbe> DefaultProbes[] = {
+		MakeDefaultProbes(EClimbProbeGroup::ClimbSideJump),
+		MakeDefaultProbes(EClimbProbeGroup::ClimbCornerInner),
+		MakeDefaultProbes(EClimbProbeGroup::ClimbCornerOuter),
+		MakeDefaultProbes(EClimbProbeGroup::HangingCornerInner),
+		MakeDefaultProbes(EClimbProbeGroup::HangingCornerOuter)
+	};
+
+	return DefaultProbes[(int32)Group];
+}
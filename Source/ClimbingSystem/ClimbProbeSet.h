@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ClimbMontageAnimConfig.h"
+#include "TraceBlueprintFunctionLibrary.h"
+#include "ClimbProbeSet.generated.h"
+
+/** Checks that come in a right and a left variant, described by probes authored for the right side. */
+UENUM(BlueprintType)
+enum class EClimbProbeGroup : uint8
+{
+	ClimbSideJump,
+	ClimbCornerInner,
+	ClimbCornerOuter,
+	HangingCornerInner,
+	HangingCornerOuter
+};
+
+UENUM(BlueprintType)
+enum class EClimbProbeOrigin : uint8
+{
+	/** Capsule center. */
+	Actor,
+	/** Top of the capsule raised by Clamb.HangingTraceOffsetZ. */
+	HangingTop
+};
+
+/**
+ * One trace of a climb check. Offsets are in character space, X forward, Y right, Z up,
+ * and are mirrored along Y for the left variant.
+ */
+USTRUCT(BlueprintType)
+struct FClimbProbe
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Line or Sphere. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ETraceShape Shape = ETraceShape::Line;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EClimbProbeOrigin Origin = EClimbProbeOrigin::Actor;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector Start = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector End = FVector::ZeroVector;
+
+	/** Added to End scaled by the capsule radius, for probes that reach just past the capsule. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector EndCapsuleOffset = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 10;
+
+	/** Character space direction the hit surface has to face. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector AcceptNormal = FVector::BackwardVector;
+
+	/** Degrees the impact normal may deviate from AcceptNormal. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AcceptAngle = 5;
+
+	/** Also trace from the origin to Start, and reject the probe if anything is in the way. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bRequireClearPath = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UClimbAction Action = UClimbAction::ClimbingAction_RightJump;
+
+	/** Action of the left variant. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UClimbAction MirroredAction = UClimbAction::ClimbingAction_LeftJump;
+};
+
+USTRUCT(BlueprintType)
+struct FClimbProbeList
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Evaluated in order, the first accepted probe wins. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FClimbProbe> Probes;
+};
+
+/**
+ * Probe descriptors of the mirrored climb checks. Groups left out of the asset use the built in defaults.
+ */
+UCLASS(BlueprintType)
+class CLIMBINGSYSTEM_API UClimbProbeSet : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TMap<EClimbProbeGroup, FClimbProbeList> Groups;
+
+	const TArray<FClimbProbe>& GetProbes(EClimbProbeGroup Group) const;
+
+	static const TArray<FClimbProbe>& GetDefaultProbes(EClimbProbeGroup Group);
+};
@@ -0,0 +1,216 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbProbeSubsystem.h"
+#include "ClimbComponent.h"
+#include "ClimbStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Batched Probes"), STAT_Climb_BatchedProbes, STATGROUP_Climbing);
+
+static bool GBatchedProbes = true;
+static FAutoConsoleVariableRef CVarBatchedProbes(
+	TEXT("Clamb.BatchedProbes"),
+	GBatchedProbes,
+	TEXT("Build and issue the async default state probes of all climbers in one batch after the component ticks"),
+	ECVF_Default
+);
+
+void FClimbProbeTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem != nullptr)
+		Subsystem->Tick(DeltaTime);
+}
+
+FString FClimbProbeTickFunction::DiagnosticMessage()
+{
+	return TEXT("FClimbProbeTickFunction");
+}
+
+void UClimbProbeSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.Subsystem = this;
+	TickFunction.bCanEverTick = true;
+	TickFunction.TickGroup = TG_PostPhysics;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UClimbProbeSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+		TickFunction.UnRegisterTickFunction();
+
+	TickFunction.Subsystem = nullptr;
+	Reset();
+
+	Super::Deinitialize();
+}
+
+void UClimbProbeSubsystem::Tick(float DeltaTime)
+{
+	if (NumClimbers == 0)
+		return;
+
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_BatchedProbes);
+
+	//Pad to whole vector registers, the padding lanes are zero and never read back
+	int32 NumPadded = Align(NumClimbers, 4);
+	auto Pad = [NumPadded](TArray<float>& Array) { Array.SetNumZeroed(NumPadded, false); };
+
+	Pad(ForwardX); Pad(ForwardY); Pad(ForwardZ);
+	Pad(RightX); Pad(RightY); Pad(RightZ);
+	Pad(UpX); Pad(UpY); Pad(UpZ);
+	for (int32 Endpoint = 0; Endpoint < MaxProbes * 2; Endpoint++)
+	{
+		Pad(OffsetForward[Endpoint]); Pad(OffsetRight[Endpoint]); Pad(OffsetUp[Endpoint]); Pad(OffsetWorldUp[Endpoint]);
+		Pad(WorldX[Endpoint]); Pad(WorldY[Endpoint]); Pad(WorldZ[Endpoint]);
+	}
+
+	TransformOffsets(NumPadded);
+
+	for (int32 Climber = 0; Climber < NumClimbers; Climber++)
+	{
+		UClimbComponent* ClimbComponent = Climbers[Climber].Get();
+		if (ClimbComponent == nullptr)
+			continue;
+
+		const FVector& Location = Locations[Climber];
+
+		for (int32 ProbeIndex = 0; ProbeIndex < NumClimberProbes[Climber]; ProbeIndex++)
+		{
+			const FProbeInfo& ProbeInfo = ProbeInfos[Climber * MaxProbes + ProbeIndex];
+			int32 StartEndpoint = ProbeIndex * 2;
+			int32 EndEndpoint = StartEndpoint + 1;
+
+			FTraceRequest Request;
+			Request.Shape = ProbeInfo.Shape;
+			Request.Radius = ProbeInfo.Radius;
+			Request.CollisionChannel = ProbeInfo.CollisionChannel;
+			Request.Start = Location + FVector(WorldX[StartEndpoint][Climber], WorldY[StartEndpoint][Climber], WorldZ[StartEndpoint][Climber]);
+			Request.End = Location + FVector(WorldX[EndEndpoint][Climber], WorldY[EndEndpoint][Climber], WorldZ[EndEndpoint][Climber]);
+
+			ClimbComponent->IssueAsyncDetectionProbe(ProbeInfo.Probe, Request, ProbeInfo.bIgnoreOwner ? ClimbComponent->DetectionIgnoreOwnerQueryParams : ClimbComponent->DetectionQueryParams);
+		}
+	}
+
+	Reset();
+}
+
+void UClimbProbeSubsystem::RegisterClimber(UClimbComponent* ClimbComponent)
+{
+	//The group alone is not enough, a climber can be moved to a later tick group than the batch
+	TickFunction.AddPrerequisite(ClimbComponent, ClimbComponent->PrimaryComponentTick);
+}
+
+void UClimbProbeSubsystem::UnregisterClimber(UClimbComponent* ClimbComponent)
+{
+	TickFunction.RemovePrerequisite(ClimbComponent, ClimbComponent->PrimaryComponentTick);
+}
+
+void UClimbProbeSubsystem::AddClimber(UClimbComponent* ClimbComponent, const FClimbFrameContext& Context, TConstArrayView<FProbeLayout> Probes)
+{
+	check(Probes.Num() <= MaxProbes);
+
+	int32 Climber = NumClimbers++;
+
+	Climbers.Add(ClimbComponent);
+	Locations.Add(Context.Location);
+	NumClimberProbes.Add((uint8)Probes.Num());
+
+	ForwardX.Add(Context.ForwardVector.X); ForwardY.Add(Context.ForwardVector.Y); ForwardZ.Add(Context.ForwardVector.Z);
+	RightX.Add(Context.RightVector.X); RightY.Add(Context.RightVector.Y); RightZ.Add(Context.RightVector.Z);
+	UpX.Add(Context.UpVector.X); UpY.Add(Context.UpVector.Y); UpZ.Add(Context.UpVector.Z);
+
+	ProbeInfos.AddUninitialized(MaxProbes);
+
+	for (int32 Endpoint = 0; Endpoint < MaxProbes * 2; Endpoint++)
+	{
+		int32 ProbeIndex = Endpoint / 2;
+		FVector4f Offset = FVector4f(0, 0, 0, 0);
+
+		if (ProbeIndex < Probes.Num())
+		{
+			Offset = (Endpoint % 2 == 0) ? Probes[ProbeIndex].StartOffset : Probes[ProbeIndex].EndOffset;
+		}
+
+		OffsetForward[Endpoint].Add(Offset.X);
+		OffsetRight[Endpoint].Add(Offset.Y);
+		OffsetUp[Endpoint].Add(Offset.Z);
+		OffsetWorldUp[Endpoint].Add(Offset.W);
+	}
+
+	for (int32 ProbeIndex = 0; ProbeIndex < Probes.Num(); ProbeIndex++)
+	{
+		const FProbeLayout& Probe = Probes[ProbeIndex];
+
+		FProbeInfo& ProbeInfo = ProbeInfos[Climber * MaxProbes + ProbeIndex];
+		ProbeInfo.Probe = Probe.Probe;
+		ProbeInfo.Shape = Probe.Shape;
+		ProbeInfo.Radius = Probe.Radius;
+		ProbeInfo.CollisionChannel = Probe.CollisionChannel;
+		ProbeInfo.bIgnoreOwner = Probe.bIgnoreOwner;
+	}
+}
+
+bool UClimbProbeSubsystem::IsEnabled()
+{
+	return GBatchedProbes;
+}
+
+bool UClimbProbeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimbProbeSubsystem::TransformOffsets(int32 NumPadded)
+{
+	for (int32 Lane = 0; Lane < NumPadded; Lane += 4)
+	{
+		VectorRegister4Float BasisForwardX = VectorLoad(&ForwardX[Lane]);
+		VectorRegister4Float BasisForwardY = VectorLoad(&ForwardY[Lane]);
+		VectorRegister4Float BasisForwardZ = VectorLoad(&ForwardZ[Lane]);
+		VectorRegister4Float BasisRightX = VectorLoad(&RightX[Lane]);
+		VectorRegister4Float BasisRightY = VectorLoad(&RightY[Lane]);
+		VectorRegister4Float BasisRightZ = VectorLoad(&RightZ[Lane]);
+		VectorRegister4Float BasisUpX = VectorLoad(&UpX[Lane]);
+		VectorRegister4Float BasisUpY = VectorLoad(&UpY[Lane]);
+		VectorRegister4Float BasisUpZ = VectorLoad(&UpZ[Lane]);
+
+		for (int32 Endpoint = 0; Endpoint < MaxProbes * 2; Endpoint++)
+		{
+			VectorRegister4Float Forward = VectorLoad(&OffsetForward[Endpoint][Lane]);
+			VectorRegister4Float Right = VectorLoad(&OffsetRight[Endpoint][Lane]);
+			VectorRegister4Float Up = VectorLoad(&OffsetUp[Endpoint][Lane]);
+			VectorRegister4Float WorldUp = VectorLoad(&OffsetWorldUp[Endpoint][Lane]);
+
+			VectorRegister4Float X = VectorMultiplyAdd(BasisForwardX, Forward, VectorMultiplyAdd(BasisRightX, Right, VectorMultiply(BasisUpX, Up)));
+			VectorRegister4Float Y = VectorMultiplyAdd(BasisForwardY, Forward, VectorMultiplyAdd(BasisRightY, Right, VectorMultiply(BasisUpY, Up)));
+			VectorRegister4Float Z = VectorMultiplyAdd(BasisForwardZ, Forward, VectorMultiplyAdd(BasisRightZ, Right, VectorMultiplyAdd(BasisUpZ, Up, WorldUp)));
+
+			VectorStore(X, &WorldX[Endpoint][Lane]);
+			VectorStore(Y, &WorldY[Endpoint][Lane]);
+			VectorStore(Z, &WorldZ[Endpoint][Lane]);
+		}
+	}
+}
+
+void UClimbProbeSubsystem::Reset()
+{
+	NumClimbers = 0;
+
+	Climbers.Reset();
+	Locations.Reset();
+	NumClimberProbes.Reset();
+	ProbeInfos.Reset();
+
+	ForwardX.Reset(); ForwardY.Reset(); ForwardZ.Reset();
+	RightX.Reset(); RightY.Reset(); RightZ.Reset();
+	UpX.Reset(); UpY.Reset(); UpZ.Reset();
+
+	for (int32 Endpoint = 0; Endpoint < MaxProbes * 2; Endpoint++)
+	{
+		OffsetForward[Endpoint].Reset(); OffsetRight[Endpoint].Reset(); OffsetUp[Endpoint].Reset(); OffsetWorldUp[Endpoint].Reset();
+		WorldX[Endpoint].Reset(); WorldY[Endpoint].Reset(); WorldZ[Endpoint].Reset();
+	}
+}
@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TraceBlueprintFunctionLibrary.h"
+#include "ClimbProbeSubsystem.generated.h"
+
+class UClimbComponent;
+struct FClimbFrameContext;
+enum class EClimbAsyncProbe : uint8;
+
+/**
+ * Runs the probe batch in TG_PostPhysics, after every registered climber ticked and queued its probes, and in time for this
+ * frame's async trace kick off at the end of the world tick. The results arrive before the climbers' next tick.
+ */
+USTRUCT()
+struct FClimbProbeTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	class UClimbProbeSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FClimbProbeTickFunction> : public TStructOpsTypeTraitsBase2<FClimbProbeTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Builds the async default state probes of every climber in the world in one pass.
+ * Climbers queue their basis and per probe offsets during their tick, the subsystem keeps them as structure of arrays,
+ * turns the offsets into world space four climbers at a time with vector math and issues all the traces in one go.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbProbeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 MaxProbes = 4;
+
+	/** One probe of a climber, its endpoints given as Forward * X + Right * Y + Up * Z + world up * W from the climber location. */
+	struct FProbeLayout
+	{
+		EClimbAsyncProbe Probe;
+		ETraceShape Shape = ETraceShape::Line;
+		float Radius = 0;
+		TEnumAsByte<ECollisionChannel> CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+		bool bIgnoreOwner = false;
+		FVector4f StartOffset = FVector4f(0, 0, 0, 0);
+		FVector4f EndOffset = FVector4f(0, 0, 0, 0);
+	};
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	void Tick(float DeltaTime);
+
+	/** Makes the batch wait for the climber's tick, so its probes go out the frame they are queued. */
+	void RegisterClimber(UClimbComponent* ClimbComponent);
+	void UnregisterClimber(UClimbComponent* ClimbComponent);
+
+	/** Queues the probes of a climber for this frame's batch. */
+	void AddClimber(UClimbComponent* ClimbComponent, const FClimbFrameContext& Context, TConstArrayView<FProbeLayout> Probes);
+
+	static bool IsEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FProbeInfo
+	{
+		EClimbAsyncProbe Probe;
+		ETraceShape Shape;
+		float Radius;
+		TEnumAsByte<ECollisionChannel> CollisionChannel;
+		bool bIgnoreOwner;
+	};
+
+	/** Writes Forward * X + Right * Y + Up * Z + world up * W of every endpoint into the offset arrays. */
+	void TransformOffsets(int32 NumPadded);
+
+	void Reset();
+
+	FClimbProbeTickFunction TickFunction;
+
+	int32 NumClimbers = 0;
+
+	TArray<TWeakObjectPtr<UClimbComponent>> Climbers;
+	TArray<FVector> Locations;
+	TArray<uint8> NumClimberProbes;
+	TArray<FProbeInfo> ProbeInfos;
+
+	//Basis of every climber, one lane per climber
+	TArray<float> ForwardX, ForwardY, ForwardZ;
+	TArray<float> RightX, RightY, RightZ;
+	TArray<float> UpX, UpY, UpZ;
+
+	//Character space endpoint offsets, indexed [Endpoint][Climber], endpoints are start and end of each probe
+	TArray<float> OffsetForward[MaxProbes * 2];
+	TArray<float> OffsetRight[MaxProbes * 2];
+	TArray<float> OffsetUp[MaxProbes * 2];
+	TArray<float> OffsetWorldUp[MaxProbes * 2];
+
+	//World space endpoint offsets, filled by TransformOffsets
+	TArray<float> WorldX[MaxProbes * 2];
+	TArray<float> WorldY[MaxProbes * 2];
+	TArray<float> WorldZ[MaxProbes * 2];
+};
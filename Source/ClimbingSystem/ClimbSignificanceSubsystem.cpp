@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSignificanceSubsystem.h"
+#include "SignificanceManager.h"
+#include "GameFramework/PlayerController.h"
+
+void UClimbSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(World);
+	if (SignificanceManager == nullptr)
+		return;
+
+	Viewpoints.Reset();
+
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr)
+			continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+
+		if (PlayerController->IsLocalController())
+		{
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		}
+		else
+		{
+			//The server does not update remote players' cameras, their view target is close enough to weigh significance
+			AActor* ViewTarget = PlayerController->GetViewTarget();
+			if (ViewTarget == nullptr)
+				ViewTarget = PlayerController->GetPawn();
+
+			if (ViewTarget == nullptr)
+				continue;
+
+			ViewLocation = ViewTarget->GetActorLocation();
+			ViewRotation = PlayerController->GetControlRotation();
+		}
+
+		Viewpoints.Add(FTransform(ViewRotation, ViewLocation));
+	}
+
+	//Without any player (e.g. a server nobody joined yet) leave every object at its current significance
+	if (Viewpoints.Num() == 0)
+		return;
+
+	SignificanceManager->Update(Viewpoints);
+}
+
+TStatId UClimbSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UClimbSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbSignificanceSubsystem.generated.h"
+
+/**
+ * Feeds the players' view points to the world's significance manager every frame, so climb components can throttle
+ * their detection by significance. Local players use their camera, remote players on a server their view target.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	TArray<FTransform> Viewpoints;
+};
@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbStats.h"
+
+DEFINE_STAT(STAT_ClimbLineTraces);
+DEFINE_STAT(STAT_ClimbSphereTraces);
+DEFINE_STAT(STAT_ClimbBoxTraces);
+DEFINE_STAT(STAT_ClimbCapsuleTraces);
+DEFINE_STAT(STAT_ClimbAsyncTraces);
+DEFINE_STAT(STAT_ClimbMontageLookups);
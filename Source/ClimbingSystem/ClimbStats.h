@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("Climbing"), STATGROUP_Climbing, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Line Traces"), STAT_ClimbLineTraces, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sphere Traces"), STAT_ClimbSphereTraces, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Box Traces"), STAT_ClimbBoxTraces, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Capsule Traces"), STAT_ClimbCapsuleTraces, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Traces"), STAT_ClimbAsyncTraces, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Montage Lookups"), STAT_ClimbMontageLookups, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+
+//Cycle counters already show up as named scopes in Insights, builds without stats fall back to a plain CPU trace scope
+#if STATS
+#define CLIMB_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define CLIMB_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
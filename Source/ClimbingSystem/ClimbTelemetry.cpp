@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTelemetry.h"
+
+static float GTelemetryWindow = 5;
+static FAutoConsoleVariableRef CVarTelemetryWindow(
+	TEXT("Clamb.TelemetryWindow"),
+	GTelemetryWindow,
+	TEXT("Seconds of climb telemetry gathered per window"),
+	ECVF_Default
+);
+
+//Traces are only issued from the game thread
+static FClimbTelemetry* GScopedTelemetry = nullptr;
+
+uint32 FClimbTelemetryWindow::GetTotalTraces() const
+{
+	uint32 Total = 0;
+	for (uint32 Count : Traces)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+uint32 FClimbTelemetryWindow::GetTotalHits() const
+{
+	uint32 Total = 0;
+	for (uint32 Count : Hits)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+void FClimbTelemetry::RecordTrace(ETraceShape Shape, bool bHit)
+{
+	int32 ShapeIndex = (int32)Shape;
+
+	Current.Traces[ShapeIndex]++;
+	TickTraces[ShapeIndex]++;
+	LifetimeTraces++;
+
+	if (bHit)
+	{
+		Current.Hits[ShapeIndex]++;
+		TickHits++;
+	}
+}
+
+void FClimbTelemetry::RecordAsyncResult(bool bValid)
+{
+	LifetimeAsyncResults++;
+
+	if (!bValid)
+		LifetimeAsyncMisses++;
+}
+
+void FClimbTelemetry::RecordTransition()
+{
+	Current.StateTransitions++;
+	LifetimeTransitions++;
+}
+
+void FClimbTelemetry::EndTick(UClimbState ClimbState, float DeltaTime)
+{
+	Current.StateTime[(int32)ClimbState] += DeltaTime;
+	Current.Duration += DeltaTime;
+	Current.Ticks++;
+
+	FMemory::Memzero(TickTraces);
+	TickHits = 0;
+
+	if (Current.Duration >= GTelemetryWindow)
+	{
+		Last = Current;
+		Current = FClimbTelemetryWindow();
+	}
+}
+
+FString FClimbTelemetry::ToString() const
+{
+	//Report the window in progress until a full one is available
+	const FClimbTelemetryWindow& Window = Last.Duration > 0 ? Last : Current;
+	if (Window.Ticks == 0 || Window.Duration <= 0)
+		return TEXT("no data");
+
+	uint32 TotalTraces = Window.GetTotalTraces();
+
+	FString Result = FString::Printf(TEXT("%.1fs, traces/tick %.1f (line %.1f, sphere %.1f, box %.1f, capsule %.1f), hit ratio %.2f, transitions/s %.2f, montages %u"),
+		Window.Duration,
+		(float)TotalTraces / Window.Ticks,
+		(float)Window.Traces[(int32)ETraceShape::Line] / Window.Ticks,
+		(float)Window.Traces[(int32)ETraceShape::Sphere] / Window.Ticks,
+		(float)Window.Traces[(int32)ETraceShape::Box] / Window.Ticks,
+		(float)Window.Traces[(int32)ETraceShape::Capsule] / Window.Ticks,
+		TotalTraces > 0 ? (float)Window.GetTotalHits() / TotalTraces : 0.f,
+		Window.StateTransitions / Window.Duration,
+		Window.MontageTriggers);
+
+	const UEnum* ClimbStateEnum = StaticEnum<UClimbState>();
+	for (int32 StateIndex = 0; StateIndex < FClimbTelemetryWindow::NumClimbStates; StateIndex++)
+	{
+		if (Window.StateTime[StateIndex] > 0)
+		{
+			Result += FString::Printf(TEXT(", %s %.0f%%"), *ClimbStateEnum->GetNameStringByValue(StateIndex), 100 * Window.StateTime[StateIndex] / Window.Duration);
+		}
+	}
+
+	return Result;
+}
+
+FClimbTelemetryScope::FClimbTelemetryScope(FClimbTelemetry* Telemetry)
+	: PreviousTelemetry(GScopedTelemetry)
+{
+	GScopedTelemetry = Telemetry;
+}
+
+FClimbTelemetryScope::~FClimbTelemetryScope()
+{
+	GScopedTelemetry = PreviousTelemetry;
+}
+
+void FClimbTelemetryScope::RecordTrace(ETraceShape Shape, bool bHit)
+{
+	if (GScopedTelemetry != nullptr && IsInGameThread())
+	{
+		GScopedTelemetry->RecordTrace(Shape, bHit);
+	}
+}
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IAnimInt.h"
+#include "TraceBlueprintFunctionLibrary.h"
+
+/** Climb metrics of one character, gathered over a window of a few seconds. */
+struct CLIMBINGSYSTEM_API FClimbTelemetryWindow
+{
+	static constexpr int32 NumTraceShapes = (int32)ETraceShape::Capsule + 1;
+	static constexpr int32 NumClimbStates = (int32)UClimbState::ZipLine + 1;
+
+	uint32 Traces[NumTraceShapes] = {};
+	uint32 Hits[NumTraceShapes] = {};
+	float StateTime[NumClimbStates] = {};
+	uint32 Ticks = 0;
+	uint32 StateTransitions = 0;
+	uint32 MontageTriggers = 0;
+	float Duration = 0;
+
+	uint32 GetTotalTraces() const;
+	uint32 GetTotalHits() const;
+};
+
+/** Rolling climb metrics of one character, the last completed window plus the one being gathered. */
+struct CLIMBINGSYSTEM_API FClimbTelemetry
+{
+	FClimbTelemetryWindow Current;
+	FClimbTelemetryWindow Last;
+
+	/** Traces of the tick in progress, by shape, for the CSV profiler. */
+	uint32 TickTraces[FClimbTelemetryWindow::NumTraceShapes] = {};
+	uint32 TickHits = 0;
+
+	/** Totals since the character spawned, never rolled over. */
+	uint64 LifetimeTraces = 0;
+	uint64 LifetimeTransitions = 0;
+
+	/** Async detection results asked for, and how many of those were not there so the check traced synchronously. */
+	uint64 LifetimeAsyncResults = 0;
+	uint64 LifetimeAsyncMisses = 0;
+
+	void RecordTrace(ETraceShape Shape, bool bHit);
+	void RecordAsyncResult(bool bValid);
+	void RecordTransition();
+
+	/** Closes the tick, rolling the window over once it is older than Clamb.TelemetryWindow. */
+	void EndTick(UClimbState ClimbState, float DeltaTime);
+
+	FString ToString() const;
+};
+
+/**
+ * Routes the traces of the trace library to Telemetry while in scope. UClimbComponent opens one in TickComponent and in the input
+ * handlers that trace, traces made from Blueprint or other callers outside of those are not counted.
+ */
+struct CLIMBINGSYSTEM_API FClimbTelemetryScope
+{
+	explicit FClimbTelemetryScope(FClimbTelemetry* Telemetry);
+	~FClimbTelemetryScope();
+
+	/** Records a trace against the telemetry of the character currently in scope, if any. */
+	static void RecordTrace(ETraceShape Shape, bool bHit);
+
+private:
+	FClimbTelemetry* PreviousTelemetry;
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTraceBudgetSubsystem.h"
+
+static int32 GDetectionTraceBudget = 0;
+static FAutoConsoleVariableRef CVarDetectionTraceBudget(
+	TEXT("Clamb.DetectionTraceBudget"),
+	GDetectionTraceBudget,
+	TEXT("Max traces per frame spent on the detection of non local climbing characters, 0 disables the budget"),
+	ECVF_Default
+);
+
+static float GDetectionPriorityAging = 0.25;
+static FAutoConsoleVariableRef CVarDetectionPriorityAging(
+	TEXT("Clamb.DetectionPriorityAging"),
+	GDetectionPriorityAging,
+	TEXT("Priority a queued detection pass gains for every frame it waits"),
+	ECVF_Default
+);
+
+void UClimbTraceBudgetSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//Grants not used on the frame they were meant for are dropped, their requester stopped asking
+	GrantedRequesters.Reset();
+
+	PendingRequests.RemoveAllSwap([](const FDetectionRequest& Request) { return !Request.Requester.IsValid(); });
+
+	if (PendingRequests.Num() == 0)
+		return;
+
+	PendingRequests.Sort([](const FDetectionRequest& A, const FDetectionRequest& B)
+	{
+		return A.Priority + A.WaitedFrames * GDetectionPriorityAging > B.Priority + B.WaitedFrames * GDetectionPriorityAging;
+	});
+
+	int32 RemainingTraces = GDetectionTraceBudget;
+	int32 GrantedCount = 0;
+
+	for (const FDetectionRequest& Request : PendingRequests)
+	{
+		//Always let the first request through, even if it costs more than the whole budget
+		if (GrantedCount > 0 && Request.TraceCount > RemainingTraces)
+			break;
+
+		GrantedRequesters.Add(Request.Requester);
+		RemainingTraces -= Request.TraceCount;
+		GrantedCount++;
+	}
+
+	PendingRequests.RemoveAt(0, GrantedCount, false);
+
+	for (FDetectionRequest& Request : PendingRequests)
+	{
+		Request.WaitedFrames++;
+	}
+}
+
+TStatId UClimbTraceBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbTraceBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool UClimbTraceBudgetSubsystem::RequestDetection(const UObject* Requester, float Priority, int32 TraceCount)
+{
+	if (GrantedRequesters.RemoveSwap(Requester) > 0)
+		return true;
+
+	FDetectionRequest* Request = PendingRequests.FindByPredicate([Requester](const FDetectionRequest& Pending) { return Pending.Requester == Requester; });
+	if (Request == nullptr)
+	{
+		Request = &PendingRequests.AddDefaulted_GetRef();
+		Request->Requester = Requester;
+		Request->WaitedFrames = 0;
+	}
+
+	Request->Priority = Priority;
+	Request->TraceCount = TraceCount;
+
+	return false;
+}
+
+void UClimbTraceBudgetSubsystem::CancelDetection(const UObject* Requester)
+{
+	GrantedRequesters.RemoveSwap(Requester);
+	PendingRequests.RemoveAllSwap([Requester](const FDetectionRequest& Pending) { return Pending.Requester == Requester; });
+}
+
+bool UClimbTraceBudgetSubsystem::IsBudgetEnabled()
+{
+	return GDetectionTraceBudget > 0;
+}
+
+bool UClimbTraceBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
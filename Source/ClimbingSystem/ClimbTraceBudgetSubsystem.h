@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbTraceBudgetSubsystem.generated.h"
+
+/**
+ * Spreads the detection passes of climb components over frames so no frame goes over Clamb.DetectionTraceBudget traces.
+ * Requests queued during a frame are granted at its end by priority, aged by how long they waited, and run on the next frame.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbTraceBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Queues a detection pass of about TraceCount traces, or updates the one already queued.
+	 * Returns true when an earlier request was granted and the pass should run now.
+	 */
+	bool RequestDetection(const UObject* Requester, float Priority, int32 TraceCount);
+
+	void CancelDetection(const UObject* Requester);
+
+	static bool IsBudgetEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FDetectionRequest
+	{
+		TWeakObjectPtr<const UObject> Requester;
+		float Priority;
+		int32 TraceCount;
+		int32 WaitedFrames;
+	};
+
+	TArray<FDetectionRequest> PendingRequests;
+	TArray<TWeakObjectPtr<const UObject>> GrantedRequesters;
+};
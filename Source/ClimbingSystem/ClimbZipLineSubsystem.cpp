@@ -0,0 +1,267 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbZipLineSubsystem.h"
+#include "ClimbStats.h"
+#include "EngineUtils.h"
+#include "Algo/Sort.h"
+#include "Components/PrimitiveComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find ZipLine"), STAT_Climb_FindZipLine, STATGROUP_Climbing);
+
+static bool GZipLineIndex = true;
+static FAutoConsoleVariableRef CVarZipLineIndex(
+	TEXT("Clamb.ZipLineIndex"),
+	GZipLineIndex,
+	TEXT("Find zip lines in the zip line subsystem's segment hierarchy instead of sweeping the zip line channel"),
+	ECVF_Default
+);
+
+static float GZipLineRadius = 5;
+static FAutoConsoleVariableRef CVarZipLineRadius(
+	TEXT("Clamb.ZipLineRadius"),
+	GZipLineRadius,
+	TEXT("Thickness of a zip line cable for the zip line subsystem's distance test, for zip lines without collision on the zip line channel"),
+	ECVF_Default
+);
+
+//Segments per leaf, below this a linear test is cheaper than another level
+static constexpr int32 ZipLineMaxLeafSegments = 4;
+
+//Object channel of the zip line cables, the one the zip line sweeps query
+static constexpr ECollisionChannel ZipLineCollisionChannel = ECC_GameTraceChannel1;
+
+void UClimbZipLineSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UClimbZipLineSubsystem::OnActorSpawned));
+
+	for (TActorIterator<AActor> Iterator(&InWorld); Iterator; ++Iterator)
+	{
+		OnActorSpawned(*Iterator);
+	}
+}
+
+void UClimbZipLineSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+
+	ZipLines.Reset();
+	Segments.Reset();
+	Nodes.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UClimbZipLineSubsystem::FindZipLine(const FVector& Start, const FVector& End, float Radius, AActor*& OutZipLine, FVector& OutImpactPoint)
+{
+	CLIMB_SCOPE_CYCLE_COUNTER(STAT_Climb_FindZipLine);
+
+	if (bDirty)
+		Rebuild();
+
+	OutZipLine = nullptr;
+
+	if (Nodes.Num() == 0)
+		return false;
+
+	//Segment bounds include their radius, the sweep's own is added here
+	FBox QueryBounds = FBox(Start.ComponentMin(End), Start.ComponentMax(End)).ExpandBy(Radius);
+	double BestDistance = Radius;
+
+	TArray<int32, TInlineAllocator<32>> NodeStack;
+	NodeStack.Add(0);
+
+	while (NodeStack.Num() > 0)
+	{
+		int32 NodeIndex = NodeStack.Pop(false);
+		const FNode& Node = Nodes[NodeIndex];
+
+		if (!Node.Bounds.Intersect(QueryBounds))
+			continue;
+
+		if (Node.Count == 0)
+		{
+			NodeStack.Add(NodeIndex + 1);
+			NodeStack.Add(Node.Second);
+			continue;
+		}
+
+		for (int32 SegmentIndex = Node.First; SegmentIndex < Node.First + Node.Count; SegmentIndex++)
+		{
+			const FSegment& Segment = Segments[SegmentIndex];
+
+			FVector PointOnSweep;
+			FVector PointOnZipLine;
+			FMath::SegmentDistToSegmentSafe(Start, End, Segment.Start, Segment.End, PointOnSweep, PointOnZipLine);
+
+			//Distance from the surface of the cable
+			double Distance = FVector::Dist(PointOnSweep, PointOnZipLine) - Segment.Radius;
+			if (Distance > BestDistance)
+				continue;
+
+			AActor* ZipLine = Segment.ZipLine.Get();
+			if (ZipLine == nullptr)
+				continue;
+
+			BestDistance = Distance;
+			OutZipLine = ZipLine;
+			OutImpactPoint = PointOnZipLine;
+		}
+	}
+
+	return OutZipLine != nullptr;
+}
+
+void UClimbZipLineSubsystem::RegisterZipLine(AActor* ZipLine)
+{
+	if (ZipLine == nullptr)
+		return;
+
+	ZipLines.AddUnique(ZipLine);
+	ZipLine->OnDestroyed.AddUniqueDynamic(this, &UClimbZipLineSubsystem::OnZipLineDestroyed);
+
+	//Static and stationary zip lines cannot move once play started
+	USceneComponent* Root = ZipLine->GetRootComponent();
+	if (Root != nullptr && Root->Mobility == EComponentMobility::Movable && !Root->TransformUpdated.IsBoundToObject(this))
+	{
+		Root->TransformUpdated.AddUObject(this, &UClimbZipLineSubsystem::OnZipLineTransformUpdated);
+	}
+
+	bDirty = true;
+}
+
+void UClimbZipLineSubsystem::UnregisterZipLine(AActor* ZipLine)
+{
+	if (ZipLine == nullptr)
+		return;
+
+	ZipLines.Remove(ZipLine);
+	ZipLine->OnDestroyed.RemoveDynamic(this, &UClimbZipLineSubsystem::OnZipLineDestroyed);
+
+	if (USceneComponent* Root = ZipLine->GetRootComponent())
+	{
+		Root->TransformUpdated.RemoveAll(this);
+	}
+
+	bDirty = true;
+}
+
+bool UClimbZipLineSubsystem::IsEnabled()
+{
+	return GZipLineIndex;
+}
+
+bool UClimbZipLineSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimbZipLineSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (Actor != nullptr && Actor->GetClass()->ImplementsInterface(UIZipSystem::StaticClass()))
+	{
+		RegisterZipLine(Actor);
+	}
+}
+
+void UClimbZipLineSubsystem::OnZipLineDestroyed(AActor* DestroyedActor)
+{
+	UnregisterZipLine(DestroyedActor);
+}
+
+void UClimbZipLineSubsystem::OnZipLineTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	//Rebuilt once at the next query however many zip lines moved this frame
+	bDirty = true;
+}
+
+float UClimbZipLineSubsystem::GetZipLineRadius(const AActor* ZipLine)
+{
+	float Radius = 0;
+
+	ZipLine->ForEachComponent<UPrimitiveComponent>(false, [&Radius](const UPrimitiveComponent* Primitive)
+	{
+		if (!Primitive->IsQueryCollisionEnabled() || Primitive->GetCollisionObjectType() != ZipLineCollisionChannel)
+			return;
+
+		//A cable is long along one of its own axes, its radius is the larger of the other two half extents
+		FVector Extent = Primitive->CalcBounds(FTransform(FQuat::Identity, FVector::ZeroVector, Primitive->GetComponentScale())).BoxExtent;
+		float CableRadius = Extent.X + Extent.Y + Extent.Z - Extent.GetMax() - Extent.GetMin();
+
+		Radius = FMath::Max(Radius, CableRadius);
+	});
+
+	return Radius > 0 ? Radius : GZipLineRadius;
+}
+
+void UClimbZipLineSubsystem::Rebuild()
+{
+	bDirty = false;
+
+	Segments.Reset();
+	Nodes.Reset();
+
+	ZipLines.RemoveAll([](const TWeakObjectPtr<AActor>& ZipLine) { return !ZipLine.IsValid(); });
+
+	for (const TWeakObjectPtr<AActor>& ZipLine : ZipLines)
+	{
+		FZipLineData ZipLineData;
+		IIZipSystem::Execute_INT_GetZipLineData(ZipLine.Get(), ZipLine->GetActorLocation(), ZipLineData);
+
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.Start = ZipLineData.ZipLineStartLocation;
+		Segment.End = ZipLineData.ZipLineEndLocation;
+		Segment.Radius = GetZipLineRadius(ZipLine.Get());
+		Segment.Bounds = FBox(Segment.Start.ComponentMin(Segment.End), Segment.Start.ComponentMax(Segment.End)).ExpandBy(Segment.Radius);
+		Segment.ZipLine = ZipLine;
+	}
+
+	if (Segments.Num() > 0)
+	{
+		BuildNode(0, Segments.Num());
+	}
+}
+
+int32 UClimbZipLineSubsystem::BuildNode(int32 First, int32 Count)
+{
+	int32 NodeIndex = Nodes.AddDefaulted();
+
+	FBox Bounds(ForceInit);
+	for (int32 SegmentIndex = First; SegmentIndex < First + Count; SegmentIndex++)
+	{
+		Bounds += Segments[SegmentIndex].Bounds;
+	}
+
+	Nodes[NodeIndex].Bounds = Bounds;
+	Nodes[NodeIndex].First = First;
+	Nodes[NodeIndex].Count = Count;
+	Nodes[NodeIndex].Second = INDEX_NONE;
+
+	if (Count <= ZipLineMaxLeafSegments)
+		return NodeIndex;
+
+	//Split at the median along the longest axis of the node
+	FVector Size = Bounds.GetSize();
+	int32 Axis = (Size.X >= Size.Y && Size.X >= Size.Z) ? 0 : (Size.Y >= Size.Z ? 1 : 2);
+
+	Algo::Sort(MakeArrayView(Segments.GetData() + First, Count), [Axis](const FSegment& A, const FSegment& B)
+	{
+		return A.Bounds.GetCenter()[Axis] < B.Bounds.GetCenter()[Axis];
+	});
+
+	int32 FirstHalf = Count / 2;
+
+	//The first child always follows its parent, only the second one needs its index kept
+	BuildNode(First, FirstHalf);
+	int32 Second = BuildNode(First + FirstHalf, Count - FirstHalf);
+
+	Nodes[NodeIndex].Count = 0;
+	Nodes[NodeIndex].Second = Second;
+
+	return NodeIndex;
+}
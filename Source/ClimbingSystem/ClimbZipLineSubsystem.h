@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "IZipSystem.h"
+#include "ClimbZipLineSubsystem.generated.h"
+
+/**
+ * Bounding volume hierarchy over the segments of every IIZipSystem actor in the world.
+ * Climb components find zip lines with an analytic segment distance test against it instead of a sweep on the zip line channel.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbZipLineSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Finds the zip line closest to a sphere of Radius moved from Start to End, the same query as a sweep on the zip line channel.
+	 * OutImpactPoint is the closest point on the zip line.
+	 */
+	bool FindZipLine(const FVector& Start, const FVector& End, float Radius, AActor*& OutZipLine, FVector& OutImpactPoint);
+
+	/**
+	 * Adds a zip line, or picks up the new segment of one that changed. Actors implementing IIZipSystem are found on their own, and
+	 * movable ones are picked up again whenever their root component moves. Call it for zip lines that change their cable otherwise.
+	 */
+	void RegisterZipLine(AActor* ZipLine);
+	void UnregisterZipLine(AActor* ZipLine);
+
+	static bool IsEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FSegment
+	{
+		FVector Start;
+		FVector End;
+		/** Radius of the cable, from the zip line's collision on the zip line channel. */
+		float Radius;
+		FBox Bounds;
+		TWeakObjectPtr<AActor> ZipLine;
+	};
+
+	/** Leaves hold Count segments from First, inner nodes have their children at Index + 1 and Second. */
+	struct FNode
+	{
+		FBox Bounds;
+		int32 First;
+		int32 Count;
+		int32 Second;
+	};
+
+	void OnActorSpawned(AActor* Actor);
+
+	UFUNCTION()
+	void OnZipLineDestroyed(AActor* DestroyedActor);
+
+	void OnZipLineTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Cable radius of the zip line's components on the zip line channel, Clamb.ZipLineRadius without any. */
+	static float GetZipLineRadius(const AActor* ZipLine);
+
+	/** Asks every zip line for its segment and rebuilds the hierarchy. Deferred to the first query, after the zip lines ran BeginPlay. */
+	void Rebuild();
+	int32 BuildNode(int32 First, int32 Count);
+
+	TArray<TWeakObjectPtr<AActor>> ZipLines;
+	TArray<FSegment> Segments;
+	TArray<FNode> Nodes;
+	bool bDirty = false;
+
+	FDelegateHandle ActorSpawnedHandle;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbComponent.h"
+#include "ClimbProbeSubsystem.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbBatchedProbeTest, "Climbing.Detection.BatchedProbesNextFrame", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FClimbBatchedProbeTest::RunTest(const FString& Parameters)
+{
+	if (!TestTrue(TEXT("Batched probes are enabled"), UClimbProbeSubsystem::IsEnabled()))
+		return false;
+
+	FClimbTestWorld TestWorld;
+
+	//A wide open floor, the walking checks consume their floor probes every pass
+	TestWorld.SpawnCube(FVector(0, 0, -10), FVector(40, 40, 0.2));
+
+	ACharacter* Character = TestWorld.SpawnClimber(FClimbTestWorld::GetClimberClass(), FVector(-1500, 0, 100));
+	if (!TestNotNull(TEXT("Climber spawned"), Character))
+		return false;
+
+	UClimbComponent* ClimbComponent = Character->FindComponentByClass<UClimbComponent>();
+	ClimbComponent->bAsyncDetection = true;
+	ClimbComponent->bUseDetectionScheduler = false;
+
+	const float DeltaTime = 1.0f / 60;
+
+	//Land, then walk forward so the floor check runs on every tick
+	for (int32 Frame = 0; Frame < 60; Frame++)
+	{
+		TestWorld.Tick(DeltaTime);
+	}
+
+	for (int32 Frame = 0; Frame < 10; Frame++)
+	{
+		ClimbComponent->SetScriptedMoveInput(FVector2D(0, 1));
+		TestWorld.Tick(DeltaTime);
+	}
+
+	if (!TestEqual(TEXT("Climber is walking"), Character->GetCharacterMovement()->MovementMode.GetValue(), MOVE_Walking))
+		return false;
+
+	const FClimbTelemetry& Telemetry = ClimbComponent->GetTelemetry();
+	uint64 StartResults = Telemetry.LifetimeAsyncResults;
+	uint64 StartMisses = Telemetry.LifetimeAsyncMisses;
+
+	for (int32 Frame = 0; Frame < 30; Frame++)
+	{
+		ClimbComponent->SetScriptedMoveInput(FVector2D(0, 1));
+		TestWorld.Tick(DeltaTime);
+	}
+
+	//Probes queued on one tick are issued the same frame and answered before the next tick, none falls back to a synchronous trace
+	TestTrue(TEXT("Walking checks asked for async results"), Telemetry.LifetimeAsyncResults > StartResults);
+	TestEqual(TEXT("Async results missing on the tick after they were queued"), Telemetry.LifetimeAsyncMisses - StartMisses, (uint64)0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,433 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbComponent.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+/**
+ * Climbing detection throughput, one test per course type plus one with every course.
+ * Each builds its own world, spawns climbers driven by scripted input and writes frame time, traces per frame
+ * and state transitions per second to Saved/Benchmarks/ClimbBenchmark-<Course>.json.
+ *
+ * Headless usage:
+ *   UnrealEditor-Cmd ClimbingSystem.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Climbing; Quit"
+ * Options:
+ *   -ClimbBenchmarkCharacters=<N>, -ClimbBenchmarkDuration=<seconds>, -ClimbBenchmarkOutput=<directory>
+ *   -ClimbBenchmarkMaxFrameMs=<ms> and -ClimbBenchmarkMaxTracesPerFrame=<traces> fail the test when p95 frame time
+ *   or traces per frame go over them.
+ */
+
+enum class EClimbBenchmarkCourse : uint8
+{
+	Wall,
+	Vault,
+	Pipe,
+	Beam,
+	NarrowSpace,
+	ZipLine,
+	Num
+};
+
+static const TCHAR* ClimbBenchmarkCourseNames[] =
+{
+	TEXT("Wall"),
+	TEXT("Vault"),
+	TEXT("Pipe"),
+	TEXT("Beam"),
+	TEXT("NarrowSpace"),
+	TEXT("ZipLine")
+};
+
+static_assert(UE_ARRAY_COUNT(ClimbBenchmarkCourseNames) == (int32)EClimbBenchmarkCourse::Num, "Every benchmark course needs a name");
+
+struct FClimbBenchmarkRun
+{
+	struct FBot
+	{
+		TWeakObjectPtr<ACharacter> Character;
+		TWeakObjectPtr<UClimbComponent> ClimbComponent;
+		FVector SpawnLocation;
+		float JumpPhase;
+		bool bJumpHeld;
+	};
+
+	FAutomationTestBase* Test;
+	FString Name;
+	TArray<EClimbBenchmarkCourse> Courses;
+
+	int32 NumCharacters = 32;
+	float Duration = 30;
+	float MaxFrameMs = 0;
+	float MaxTracesPerFrame = 0;
+
+	//Fixed step, so every run simulates the same frames
+	static constexpr float DeltaTime = 1.0f / 60;
+	static constexpr float WarmupTime = 3;
+	static constexpr float LaneLength = 1500;
+	static constexpr float LaneSpacing = 800;
+	static constexpr float JumpInterval = 1.5;
+
+	TUniquePtr<FClimbTestWorld> TestWorld;
+	TArray<FBot> Bots;
+
+	float ElapsedTime = 0;
+	float MeasuredTime = 0;
+	TArray<float> FrameTimes;
+	uint64 StartTraces = 0;
+	uint64 StartTransitions = 0;
+
+	bool Start();
+	bool Tick();
+	void Finish();
+
+	void BuildLane(EClimbBenchmarkCourse Course, const FVector& LaneOrigin);
+	void SpawnBots();
+	void DriveBot(FBot& Bot);
+
+	uint64 GetTotalTraces() const;
+	uint64 GetTotalTransitions() const;
+	FString MakeReport(uint64 Traces, uint64 Transitions) const;
+};
+
+bool FClimbBenchmarkRun::Start()
+{
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbBenchmarkCharacters="), NumCharacters);
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbBenchmarkDuration="), Duration);
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbBenchmarkMaxFrameMs="), MaxFrameMs);
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbBenchmarkMaxTracesPerFrame="), MaxTracesPerFrame);
+	NumCharacters = FMath::Max(1, NumCharacters);
+	Duration = FMath::Max(1.0f, Duration);
+
+	TestWorld = MakeUnique<FClimbTestWorld>();
+
+	FVector LaneOrigin = FVector::ZeroVector;
+	for (EClimbBenchmarkCourse Course : Courses)
+	{
+		BuildLane(Course, LaneOrigin);
+		LaneOrigin.Y += LaneSpacing;
+	}
+
+	SpawnBots();
+
+	if (Bots.Num() == 0)
+	{
+		Test->AddError(TEXT("No climbers could be spawned, the default pawn needs a UClimbComponent"));
+		return false;
+	}
+
+	Test->AddInfo(FString::Printf(TEXT("Running %d characters on %d lanes for %.1fs after %.1fs of warmup"), Bots.Num(), Courses.Num(), Duration, WarmupTime));
+	return true;
+}
+
+bool FClimbBenchmarkRun::Tick()
+{
+	for (FBot& Bot : Bots)
+	{
+		DriveBot(Bot);
+	}
+
+	//Wall clock time of the world tick alone, the editor's own frame would only add noise
+	double StartSeconds = FPlatformTime::Seconds();
+	TestWorld->Tick(DeltaTime);
+	float FrameTime = FPlatformTime::Seconds() - StartSeconds;
+
+	ElapsedTime += DeltaTime;
+
+	if (ElapsedTime <= WarmupTime)
+	{
+		StartTraces = GetTotalTraces();
+		StartTransitions = GetTotalTransitions();
+		return false;
+	}
+
+	FrameTimes.Add(FrameTime * 1000);
+	MeasuredTime += DeltaTime;
+
+	if (MeasuredTime < Duration)
+		return false;
+
+	Finish();
+	return true;
+}
+
+void FClimbBenchmarkRun::Finish()
+{
+	uint64 Traces = GetTotalTraces() - StartTraces;
+	uint64 Transitions = GetTotalTransitions() - StartTransitions;
+
+	FString Report = MakeReport(Traces, Transitions);
+
+	FString OutputDirectory = FPaths::ProjectSavedDir() / TEXT("Benchmarks");
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbBenchmarkOutput="), OutputDirectory);
+	FString ReportPath = OutputDirectory / FString::Printf(TEXT("ClimbBenchmark-%s.json"), *Name);
+
+	if (FFileHelper::SaveStringToFile(Report, *ReportPath))
+	{
+		Test->AddInfo(FString::Printf(TEXT("Results written to %s"), *ReportPath));
+	}
+	else
+	{
+		Test->AddError(FString::Printf(TEXT("Failed to write results to %s"), *ReportPath));
+	}
+
+	Test->AddInfo(Report);
+
+	if (Traces == 0)
+	{
+		Test->AddError(TEXT("Climbers ran no detection traces"));
+	}
+
+	TArray<float> SortedFrameTimes = FrameTimes;
+	SortedFrameTimes.Sort();
+	float P95FrameTime = SortedFrameTimes[FMath::Min(SortedFrameTimes.Num() - 1, FMath::FloorToInt32(SortedFrameTimes.Num() * 0.95f))];
+
+	if (MaxFrameMs > 0 && P95FrameTime > MaxFrameMs)
+	{
+		Test->AddError(FString::Printf(TEXT("p95 frame time %.3fms is over the %.3fms budget"), P95FrameTime, MaxFrameMs));
+	}
+
+	float TracesPerFrame = (double)Traces / FrameTimes.Num();
+	if (MaxTracesPerFrame > 0 && TracesPerFrame > MaxTracesPerFrame)
+	{
+		Test->AddError(FString::Printf(TEXT("%.2f traces per frame is over the budget of %.2f"), TracesPerFrame, MaxTracesPerFrame));
+	}
+
+	Bots.Reset();
+	TestWorld.Reset();
+}
+
+void FClimbBenchmarkRun::BuildLane(EClimbBenchmarkCourse Course, const FVector& LaneOrigin)
+{
+	float LaneWidth = LaneSpacing * 0.75;
+	TestWorld->SpawnCube(LaneOrigin + FVector(LaneLength * 0.5, 0, -10), FVector(LaneLength / 100, LaneWidth / 100, 0.2));
+
+	FVector ElementLocation = LaneOrigin + FVector(LaneLength * 0.5, 0, 0);
+
+	switch (Course)
+	{
+		case EClimbBenchmarkCourse::Wall:
+			TestWorld->SpawnCube(ElementLocation + FVector(0, 0, 200), FVector(1, LaneWidth / 100, 4));
+			break;
+		case EClimbBenchmarkCourse::Vault:
+			TestWorld->SpawnCube(ElementLocation + FVector(0, 0, 50), FVector(0.5, LaneWidth / 100, 1));
+			break;
+		case EClimbBenchmarkCourse::Pipe:
+			for (float Y = -LaneWidth * 0.5 + 50; Y < LaneWidth * 0.5; Y += 100)
+			{
+				TestWorld->SpawnCylinder(ElementLocation + FVector(0, Y, 300), FVector(0.2, 0.2, 6));
+			}
+			break;
+		case EClimbBenchmarkCourse::Beam:
+			for (float Y = -LaneWidth * 0.5 + 50; Y < LaneWidth * 0.5; Y += 100)
+			{
+				TestWorld->SpawnCube(ElementLocation + FVector(0, Y, 50), FVector(8, 0.2, 1));
+			}
+			break;
+		case EClimbBenchmarkCourse::NarrowSpace:
+			for (float Y = -LaneWidth * 0.5 + 80; Y < LaneWidth * 0.5; Y += 160)
+			{
+				TestWorld->SpawnCube(ElementLocation + FVector(0, Y - 80, 150), FVector(8, 0.2, 3));
+				TestWorld->SpawnCube(ElementLocation + FVector(0, Y + 80, 150), FVector(8, 0.2, 3));
+			}
+			break;
+		case EClimbBenchmarkCourse::ZipLine:
+			if (TestWorld->SpawnActor(FClimbTestWorld::GetZipLineClass(), ElementLocation + FVector(0, 0, 400)) == nullptr)
+			{
+				Test->AddError(TEXT("Could not spawn the zip line"));
+			}
+			break;
+	}
+}
+
+void FClimbBenchmarkRun::SpawnBots()
+{
+	UClass* ClimberClass = FClimbTestWorld::GetClimberClass();
+
+	//Fixed seed so runs are comparable
+	FRandomStream Random(0x436c696d);
+
+	for (int32 i = 0; i < NumCharacters; i++)
+	{
+		int32 LaneIndex = i % Courses.Num();
+		float LaneWidth = LaneSpacing * 0.75;
+
+		FVector SpawnLocation = FVector(
+			Random.FRandRange(100, LaneLength * 0.3),
+			LaneIndex * LaneSpacing + Random.FRandRange(-LaneWidth * 0.4, LaneWidth * 0.4),
+			120);
+
+		ACharacter* Character = TestWorld->SpawnClimber(ClimberClass, SpawnLocation);
+		if (Character == nullptr)
+			return;
+
+		FBot& Bot = Bots.AddDefaulted_GetRef();
+		Bot.Character = Character;
+		Bot.ClimbComponent = Character->FindComponentByClass<UClimbComponent>();
+		Bot.SpawnLocation = SpawnLocation;
+		Bot.JumpPhase = Random.FRandRange(0, JumpInterval);
+		Bot.bJumpHeld = false;
+	}
+}
+
+void FClimbBenchmarkRun::DriveBot(FBot& Bot)
+{
+	ACharacter* Character = Bot.Character.Get();
+	UClimbComponent* ClimbComponent = Bot.ClimbComponent.Get();
+	if (Character == nullptr || ClimbComponent == nullptr)
+		return;
+
+	//Send bots that ran off the end or fell off the course back to the start of their lane
+	FVector CharacterLocation = Character->GetActorLocation();
+	if (CharacterLocation.X > LaneLength || CharacterLocation.Z < -500)
+	{
+		Character->SetActorLocation(Bot.SpawnLocation, false, nullptr, ETeleportType::ResetPhysics);
+	}
+
+	//Forward into the course element, swaying sideways to move along ledges, pipes and beams
+	float Sway = FMath::Sin(ElapsedTime * 0.5 + Bot.JumpPhase * 4);
+	ClimbComponent->SetScriptedMoveInput(FVector2D(Sway, 1));
+
+	if (Bot.bJumpHeld)
+	{
+		ClimbComponent->SetScriptedJump(false);
+		Bot.bJumpHeld = false;
+	}
+
+	Bot.JumpPhase += DeltaTime;
+	if (Bot.JumpPhase >= JumpInterval)
+	{
+		Bot.JumpPhase -= JumpInterval;
+		ClimbComponent->SetScriptedJump(true);
+		Bot.bJumpHeld = true;
+	}
+}
+
+uint64 FClimbBenchmarkRun::GetTotalTraces() const
+{
+	uint64 Total = 0;
+	for (const FBot& Bot : Bots)
+	{
+		if (const UClimbComponent* ClimbComponent = Bot.ClimbComponent.Get())
+		{
+			Total += ClimbComponent->GetTelemetry().LifetimeTraces;
+		}
+	}
+	return Total;
+}
+
+uint64 FClimbBenchmarkRun::GetTotalTransitions() const
+{
+	uint64 Total = 0;
+	for (const FBot& Bot : Bots)
+	{
+		if (const UClimbComponent* ClimbComponent = Bot.ClimbComponent.Get())
+		{
+			Total += ClimbComponent->GetTelemetry().LifetimeTransitions;
+		}
+	}
+	return Total;
+}
+
+FString FClimbBenchmarkRun::MakeReport(uint64 Traces, uint64 Transitions) const
+{
+	TArray<float> SortedFrameTimes = FrameTimes;
+	SortedFrameTimes.Sort();
+
+	int32 NumFrames = SortedFrameTimes.Num();
+	float TotalFrameTime = 0;
+	for (float FrameTime : SortedFrameTimes)
+	{
+		TotalFrameTime += FrameTime;
+	}
+
+	auto Percentile = [&SortedFrameTimes, NumFrames](float Fraction)
+	{
+		return NumFrames > 0 ? SortedFrameTimes[FMath::Min(NumFrames - 1, FMath::FloorToInt32(NumFrames * Fraction))] : 0.0f;
+	};
+
+	FString CourseList;
+	for (EClimbBenchmarkCourse Course : Courses)
+	{
+		if (!CourseList.IsEmpty())
+		{
+			CourseList += TEXT(", ");
+		}
+		CourseList += FString::Printf(TEXT("\"%s\""), ClimbBenchmarkCourseNames[(int32)Course]);
+	}
+
+	FString Report;
+	Report += TEXT("{\n");
+	Report += FString::Printf(TEXT("\t\"test\": \"%s\",\n"), *Name);
+	Report += FString::Printf(TEXT("\t\"characterClass\": \"%s\",\n"), *GetNameSafe(FClimbTestWorld::GetClimberClass()));
+	Report += FString::Printf(TEXT("\t\"characters\": %d,\n"), Bots.Num());
+	Report += FString::Printf(TEXT("\t\"courses\": [%s],\n"), *CourseList);
+	Report += FString::Printf(TEXT("\t\"duration\": %.3f,\n"), MeasuredTime);
+	Report += FString::Printf(TEXT("\t\"frames\": %d,\n"), NumFrames);
+	Report += TEXT("\t\"frameTimeMs\": {\n");
+	Report += FString::Printf(TEXT("\t\t\"avg\": %.3f,\n"), NumFrames > 0 ? TotalFrameTime / NumFrames : 0.0f);
+	Report += FString::Printf(TEXT("\t\t\"p50\": %.3f,\n"), Percentile(0.5f));
+	Report += FString::Printf(TEXT("\t\t\"p95\": %.3f,\n"), Percentile(0.95f));
+	Report += FString::Printf(TEXT("\t\t\"max\": %.3f\n"), NumFrames > 0 ? SortedFrameTimes.Last() : 0.0f);
+	Report += TEXT("\t},\n");
+	Report += FString::Printf(TEXT("\t\"tracesPerFrame\": %.2f,\n"), NumFrames > 0 ? (double)Traces / NumFrames : 0.0);
+	Report += FString::Printf(TEXT("\t\"transitionsPerSecond\": %.2f\n"), MeasuredTime > 0 ? (double)Transitions / MeasuredTime : 0.0);
+	Report += TEXT("}\n");
+
+	return Report;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FClimbBenchmarkTickCommand, TSharedRef<FClimbBenchmarkRun>, Run);
+
+bool FClimbBenchmarkTickCommand::Update()
+{
+	//One world tick per engine frame, so async loads and the automation controller keep going in between
+	return Run->Tick();
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FClimbBenchmarkTest, "Climbing.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FClimbBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (int32 Course = 0; Course < (int32)EClimbBenchmarkCourse::Num; Course++)
+	{
+		OutBeautifiedNames.Add(ClimbBenchmarkCourseNames[Course]);
+		OutTestCommands.Add(ClimbBenchmarkCourseNames[Course]);
+	}
+
+	OutBeautifiedNames.Add(TEXT("AllCourses"));
+	OutTestCommands.Add(TEXT("AllCourses"));
+}
+
+bool FClimbBenchmarkTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FClimbBenchmarkRun> Run = MakeShared<FClimbBenchmarkRun>();
+	Run->Test = this;
+	Run->Name = Parameters;
+
+	for (int32 Course = 0; Course < (int32)EClimbBenchmarkCourse::Num; Course++)
+	{
+		if (Parameters == TEXT("AllCourses") || Parameters == ClimbBenchmarkCourseNames[Course])
+		{
+			Run->Courses.Add((EClimbBenchmarkCourse)Course);
+		}
+	}
+
+	if (!TestTrue(TEXT("Benchmark course is known"), Run->Courses.Num() > 0))
+		return false;
+
+	if (!Run->Start())
+		return false;
+
+	ADD_LATENT_AUTOMATION_COMMAND(FClimbBenchmarkTickCommand(Run));
+	return true;
+}
+
+#endif
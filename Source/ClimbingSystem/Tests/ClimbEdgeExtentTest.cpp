@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbTelemetry.h"
+#include "TraceBlueprintFunctionLibrary.h"
+#include "Misc/AutomationTest.h"
+
+/** The fixed step scan FindEdgeExtent replaced in ObstacleCheckDefault and DefaultFloorCheck, kept as the reference. */
+static bool LinearEdgeExtent(const UWorld* World, const FVector& Start, const FVector& End, const FVector& Direction, float Step, int32 NumSteps, const FCollisionQueryParams& QueryParams, FHitResult& OutLastHit)
+{
+	bool bFoundHit = false;
+
+	for (int32 i = 1; i <= NumSteps; i++)
+	{
+		FHitResult TraceResult;
+		UTraceBlueprintFunctionLibrary::LineTrace(World, Start + Direction * Step * i, End + Direction * Step * i, QueryParams, TraceResult);
+
+		if (!TraceResult.bBlockingHit)
+			break;
+
+		OutLastHit = TraceResult;
+		bFoundHit = true;
+	}
+
+	return bFoundHit;
+}
+
+struct FEdgeExtentCase
+{
+	const TCHAR* Name;
+	/** Extents of the blocks along the probe direction, every case is a row of blocks with gaps between them. */
+	TArray<FVector2D> Blocks;
+	/** Where the surface ends along the probe direction, at its first gap or edge. Kept off the 1cm grid the searches sample, gaps sit on a coarse step. */
+	float SurfaceEnd;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbEdgeExtentTest, "Climbing.Trace.EdgeExtent", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FClimbEdgeExtentTest::RunTest(const FString& Parameters)
+{
+	//Same window as the call sites in UClimbComponent
+	const float MaxDistance = 20;
+	const float Step = 2;
+	const float Precision = 1;
+
+	TArray<FEdgeExtentCase> Cases =
+	{
+		{ TEXT("PastWindow"), { FVector2D(-50, 50) }, 50 },
+		{ TEXT("EdgeInWindow"), { FVector2D(-50, 13.3) }, 13.3 },
+		{ TEXT("GapInWindow"), { FVector2D(-50, 7.4), FVector2D(11, 50) }, 7.4 },
+		{ TEXT("NarrowNotchOnCoarseStep"), { FVector2D(-50, 15.5), FVector2D(16.5, 50) }, 15.5 },
+		{ TEXT("GapAtStart"), { FVector2D(-50, 1), FVector2D(5, 50) }, 1 },
+		{ TEXT("NoSurface"), { FVector2D(-50, -1) }, -1 }
+	};
+
+	FClimbTestWorld TestWorld;
+
+	//Balance beams are probed with downward traces moving sideways, ledges with traces into the wall moving down
+	struct FProbeLayout
+	{
+		const TCHAR* Name;
+		FVector Direction;
+		FVector TraceDirection;
+	};
+
+	const FProbeLayout Layouts[] =
+	{
+		{ TEXT("Beam"), FVector::RightVector, FVector::DownVector },
+		{ TEXT("Ledge"), FVector::DownVector, FVector::ForwardVector }
+	};
+
+	struct FPlacedCase
+	{
+		const FEdgeExtentCase* Case;
+		const FProbeLayout* Layout;
+		FVector Start;
+		FVector End;
+	};
+
+	TArray<FPlacedCase> PlacedCases;
+
+	for (int32 LayoutIndex = 0; LayoutIndex < UE_ARRAY_COUNT(Layouts); LayoutIndex++)
+	{
+		const FProbeLayout& Layout = Layouts[LayoutIndex];
+
+		for (int32 CaseIndex = 0; CaseIndex < Cases.Num(); CaseIndex++)
+		{
+			//Far enough apart that no probe reaches the blocks of another case
+			FVector Origin(CaseIndex * 500, LayoutIndex * 1000, 1000);
+
+			//The surface faces against TraceDirection, 20 thick, 40 across
+			FVector Across = FVector::CrossProduct(Layout.Direction, Layout.TraceDirection);
+			for (const FVector2D& Block : Cases[CaseIndex].Blocks)
+			{
+				FVector Center = Origin + Layout.Direction * (Block.X + Block.Y) * 0.5 + Layout.TraceDirection * 10;
+				FVector Size = (Layout.Direction * (Block.Y - Block.X) + Layout.TraceDirection * 20 + Across * 40).GetAbs();
+				TestWorld.SpawnCube(Center, Size / 100);
+			}
+
+			FPlacedCase& PlacedCase = PlacedCases.AddDefaulted_GetRef();
+			PlacedCase.Case = &Cases[CaseIndex];
+			PlacedCase.Layout = &Layout;
+			PlacedCase.Start = Origin - Layout.TraceDirection * 10;
+			PlacedCase.End = Origin + Layout.TraceDirection * 5;
+		}
+	}
+
+	//Scene queries only see the blocks once physics has ticked
+	TestWorld.Tick(1.0f / 60);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbEdgeExtentTest), false);
+
+	//The first step, the coarse steps of 4 * Step to MaxDistance, then the bisection of one coarse step down to Precision
+	const uint64 MaxTraces = 1 + FMath::CeilToInt(MaxDistance / (Step * 4)) + FMath::CeilToInt(FMath::Log2(Step * 4 / Precision));
+	const uint64 LinearTraces = FMath::RoundToInt(MaxDistance / Step);
+
+	for (const FPlacedCase& PlacedCase : PlacedCases)
+	{
+		FString CaseName = FString::Printf(TEXT("%s %s"), PlacedCase.Layout->Name, PlacedCase.Case->Name);
+		const FVector& Direction = PlacedCase.Layout->Direction;
+
+		FHitResult LinearHit;
+		bool bLinearFound = LinearEdgeExtent(TestWorld.GetWorld(), PlacedCase.Start, PlacedCase.End, Direction, Step, FMath::RoundToInt(MaxDistance / Step), QueryParams, LinearHit);
+
+		FClimbTelemetry Telemetry;
+		FHitResult Hit;
+		bool bFound;
+		{
+			FClimbTelemetryScope TelemetryScope(&Telemetry);
+			bFound = UTraceBlueprintFunctionLibrary::FindEdgeExtent(TestWorld.GetWorld(), PlacedCase.Start, PlacedCase.End, Direction, MaxDistance, Step, Precision, QueryParams, Hit);
+		}
+
+		TestTrue(*FString::Printf(TEXT("%s took %llu traces, at most %llu"), *CaseName, Telemetry.LifetimeTraces, MaxTraces), Telemetry.LifetimeTraces <= MaxTraces);
+		TestTrue(*FString::Printf(TEXT("%s took %llu traces, fewer than the linear scan's %llu"), *CaseName, Telemetry.LifetimeTraces, LinearTraces), Telemetry.LifetimeTraces < LinearTraces);
+
+		if (!TestEqual(*FString::Printf(TEXT("%s finds a surface like the linear scan"), *CaseName), bFound, bLinearFound) || !bFound)
+			continue;
+
+		float LinearExtent = FVector::DotProduct(LinearHit.TraceStart - PlacedCase.Start, Direction);
+		float Extent = FVector::DotProduct(Hit.TraceStart - PlacedCase.Start, Direction);
+
+		//Never short of the linear scan, and only refined within the step past it
+		TestTrue(*FString::Printf(TEXT("%s extent %.2f is not short of the linear scan's %.2f"), *CaseName, Extent, LinearExtent), Extent >= LinearExtent - UE_KINDA_SMALL_NUMBER);
+		TestTrue(*FString::Printf(TEXT("%s extent %.2f stays within a step of the linear scan's %.2f"), *CaseName, Extent, LinearExtent), Extent < LinearExtent + Step);
+
+		//Never past the first gap
+		float SurfaceEnd = FMath::Min(PlacedCase.Case->SurfaceEnd, MaxDistance);
+		TestTrue(*FString::Printf(TEXT("%s extent %.2f does not pass the surface end %.2f"), *CaseName, Extent, SurfaceEnd), Extent <= SurfaceEnd + UE_KINDA_SMALL_NUMBER);
+		TestTrue(*FString::Printf(TEXT("%s extent %.2f is within precision of the surface end %.2f"), *CaseName, Extent, SurfaceEnd), SurfaceEnd - Extent <= Precision + UE_KINDA_SMALL_NUMBER);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbComponent.h"
+#include "ClimbMassFragments.h"
+#include "ClimbMassProcessor.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbMassPromotionTest, "Climbing.Mass.PromotionResumesClimb", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FClimbMassPromotionTest::RunTest(const FString& Parameters)
+{
+	FClimbTestWorld TestWorld;
+
+	//Floor, and a 400 high wall whose front face is at X = -50 facing -X
+	TestWorld.SpawnCube(FVector(0, 0, -10), FVector(20, 20, 0.2));
+	TestWorld.SpawnCube(FVector(0, 0, 200), FVector(1, 4, 4));
+
+	FClimbMassParameters Params;
+	Params.PromotedClass = FClimbTestWorld::GetClimberClass();
+	if (!TestNotNull(TEXT("Climber class"), Params.PromotedClass.Get()))
+		return false;
+
+	const FVector WallNormal(-1, 0, 0);
+	const FVector LedgePoint(-50, 0, 400);
+	const float DeltaTime = 1.0f / 60;
+
+	for (UClimbState PromotedState : { UClimbState::Climbing, UClimbState::Hanging })
+	{
+		const FString StateName = StaticEnum<UClimbState>()->GetNameStringByValue((int64)PromotedState);
+
+		//What the crowd processor leaves on an entity part way up the face, or hanging below the ledge
+		float EntityZ = PromotedState == UClimbState::Climbing ? 150 : LedgePoint.Z - Params.HangingDepth;
+
+		FClimbMassStateFragment State;
+		State.ClimbState = PromotedState;
+
+		FClimbMassObstacleFragment Obstacle;
+		Obstacle.ObstacleLocation = PromotedState == UClimbState::Climbing ? FVector(LedgePoint.X, LedgePoint.Y, EntityZ) : LedgePoint;
+		Obstacle.ObstacleNormalDir = WallNormal;
+		Obstacle.ClimbingRotation = FRotator(0, (-WallNormal).Rotation().Yaw, 0);
+
+		FVector EntityLocation(LedgePoint.X + WallNormal.X * Params.CapsuleRadius, LedgePoint.Y, EntityZ);
+		FTransform Transform(Obstacle.ClimbingRotation, EntityLocation);
+
+		ACharacter* Character = UClimbMassPromotionProcessor::PromoteEntity(TestWorld.GetWorld(), Params, Transform, State, Obstacle);
+		if (!TestNotNull(FString::Printf(TEXT("%s climber promoted"), *StateName), Character))
+			return false;
+
+		UClimbComponent* ClimbComponent = Character->FindComponentByClass<UClimbComponent>();
+		if (!TestNotNull(FString::Printf(TEXT("%s climber has a climb component"), *StateName), ClimbComponent))
+			return false;
+
+		for (int32 Frame = 0; Frame < 30; Frame++)
+		{
+			TestWorld.Tick(DeltaTime);
+		}
+
+		//The character carries on where the entity was instead of dropping off the wall
+		TestEqual(FString::Printf(TEXT("%s state resumed"), *StateName), ClimbComponent->GetClimbState(), PromotedState);
+		TestEqual(FString::Printf(TEXT("%s climber is flying"), *StateName), Character->GetCharacterMovement()->MovementMode.GetValue(), MOVE_Flying);
+		TestTrue(FString::Printf(TEXT("%s climber faces the wall"), *StateName), Character->GetActorForwardVector().Equals(-WallNormal, 0.01f));
+		TestTrue(FString::Printf(TEXT("%s climber stays at its height"), *StateName), FMath::Abs(Character->GetActorLocation().Z - EntityZ) < 10);
+
+		Character->Destroy();
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,324 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbMontageAnimConfig.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "UObject/UnrealType.h"
+
+/** The switch UClimbMontageAnimConfig::GetMontagePlayInofoByClimbAction used before the montage table, copying the list it picks from. */
+static bool SwitchMontagePlayInofoByClimbAction(const UClimbMontageAnimConfig& Config, UClimbAction ClimbAction, FMontagePlayInofo& outMontagePlayInofo)
+{
+	TArray<FMontagePlayInofo> MontagePlayInofoList;
+
+	switch (ClimbAction)
+	{
+	case UClimbAction::ClimbingAction_FallToClimbing:
+		MontagePlayInofoList = Config.ClimbingActionFallToClimbing;
+		break;
+	case UClimbAction::ClimbingAction_ClimbUpLand:
+		MontagePlayInofoList = Config.ClimbingActionClimbUpLand;
+		break;
+	case UClimbAction::ClimbingAction_JumpUp:
+		MontagePlayInofoList = Config.ClimbingActionJumpUp;
+		break;
+	case UClimbAction::ClimbingAction_JumpDown:
+		MontagePlayInofoList = Config.ClimbingActionJumpDown;
+		break;
+	case UClimbAction::ClimbingAction_LandDown:
+		MontagePlayInofoList = Config.ClimbingActionLandDown;
+		break;
+	case UClimbAction::ClimbingAction_LeftJump:
+		MontagePlayInofoList = Config.ClimbingActionLeftJump;
+		break;
+	case UClimbAction::ClimbingAction_SuperLeftJump:
+		MontagePlayInofoList = Config.ClimbingActionSuperLeftJump;
+		break;
+	case UClimbAction::ClimbingAction_RightJump:
+		MontagePlayInofoList = Config.ClimbingActionRightJump;
+		break;
+	case UClimbAction::ClimbingAction_SuperRightJump:
+		MontagePlayInofoList = Config.ClimbingActionSuperRightJump;
+		break;
+	case UClimbAction::ClimbingAction_InnerLeft:
+		MontagePlayInofoList = Config.ClimbingActionInnerLeft;
+		break;
+	case UClimbAction::ClimbingAction_InnerRight:
+		MontagePlayInofoList = Config.ClimbingActionInnerRight;
+		break;
+	case UClimbAction::ClimbingAction_OuterLeft:
+		MontagePlayInofoList = Config.ClimbingActionOuterLeft;
+		break;
+	case UClimbAction::ClimbingAction_OuterRight:
+		MontagePlayInofoList = Config.ClimbingActionOuterRight;
+		break;
+	case UClimbAction::ClimbingAction_UpVault:
+		MontagePlayInofoList = Config.ClimbingActionUpVault;
+		break;
+	case UClimbAction::ClimbingAction_UpTurnVault:
+		MontagePlayInofoList = Config.ClimbingActionUpTurnVault;
+		break;
+	case UClimbAction::ClimbingAction_ClimbingToHanging:
+		MontagePlayInofoList = Config.ClimbingActionClimbingToHanging;
+		break;
+	case UClimbAction::ClimbAction_Climb220:
+		MontagePlayInofoList = Config.ClimbActionClimb220;
+		break;
+	case UClimbAction::ClimbAction_Climb100:
+		MontagePlayInofoList = Config.ClimbActionClimb100;
+		break;
+	case UClimbAction::ClimbAction_Vault220:
+		MontagePlayInofoList = Config.ClimbActionVault220;
+		break;
+	case UClimbAction::ClimbAction_Vault100:
+		MontagePlayInofoList = Config.ClimbActionVault100;
+		break;
+	case UClimbAction::ClimbAction_VaultTurn220:
+		MontagePlayInofoList = Config.ClimbActionVaultTurn220;
+		break;
+	case UClimbAction::ClimbAction_VaultTurn100:
+		MontagePlayInofoList = Config.ClimbActionVaultTurn100;
+		break;
+	case UClimbAction::ClimbPipeAction_StartClimbPipe:
+		MontagePlayInofoList = Config.ClimbPipeStartClimbPipe;
+		break;
+	case UClimbAction::ClimbPipeAction_ClimbUpLand:
+		MontagePlayInofoList = Config.ClimbPipeClimbUpLand;
+		break;
+	case UClimbAction::ClimbPipeAction_LandDown:
+		MontagePlayInofoList = Config.ClimbPipeLandDown;
+		break;
+	case UClimbAction::ClimbPipeAction_LeftJump:
+		MontagePlayInofoList = Config.ClimbPipeLeftJump;
+		break;
+	case UClimbAction::ClimbPipeAction_RightJump:
+		MontagePlayInofoList = Config.ClimbPipeRightJump;
+		break;
+	case UClimbAction::Hanging_AttachHanging:
+		MontagePlayInofoList = Config.HangingAttachHanging;
+		break;
+	case UClimbAction::Hanging_InnerLeft:
+		MontagePlayInofoList = Config.HangingInnerLeft;
+		break;
+	case UClimbAction::Hanging_InnerRight:
+		MontagePlayInofoList = Config.HangingInnerRight;
+		break;
+	case UClimbAction::Hanging_OuterLeft:
+		MontagePlayInofoList = Config.HangingOuterLeft;
+		break;
+	case UClimbAction::Hanging_OuterRight:
+		MontagePlayInofoList = Config.HangingOuterRight;
+		break;
+	case UClimbAction::Hanging_ClimbUp:
+		MontagePlayInofoList = Config.HangingClimbUp;
+		break;
+	case UClimbAction::Hanging_Turn:
+		MontagePlayInofoList = Config.HangingTurn;
+		break;
+	case UClimbAction::Hanging_Drop:
+		MontagePlayInofoList = Config.HangingDrop;
+		break;
+	case UClimbAction::FallToLand_Roll:
+		MontagePlayInofoList = Config.FallToLandRoll;
+		break;
+	case UClimbAction::FallToLand_Front:
+		MontagePlayInofoList = Config.FallToLandFront;
+		break;
+	case UClimbAction::FallToLand_LandingGround:
+		MontagePlayInofoList = Config.FallToLandLandingGround;
+		break;
+	case UClimbAction::Walk_Slider:
+		MontagePlayInofoList = Config.WalkSlider;
+		break;
+	case UClimbAction::Walk_WalkToBalance:
+		MontagePlayInofoList = Config.WalkToBalance;
+		break;
+	case UClimbAction::Walk_WalkToNarrowSpace:
+		MontagePlayInofoList = Config.WalkToNarrowSpace;
+		break;
+	case UClimbAction::Walk_WalkToLedgeWalkRight:
+		MontagePlayInofoList = Config.WalkToLedgeWalkRight;
+		break;
+	case UClimbAction::Walk_WalkToLedgeWalkLeft:
+		MontagePlayInofoList = Config.WalkToLedgeWalkLeft;
+		break;
+	case UClimbAction::Walk_WalkToZipLine:
+		MontagePlayInofoList = Config.WalkToZipLine;
+		break;
+	case UClimbAction::Balance_BalanceUpToWalk:
+		MontagePlayInofoList = Config.BalanceUpToWalk;
+		break;
+	case UClimbAction::Balance_BalanceDownToWalk:
+		MontagePlayInofoList = Config.BalanceDownToWalk;
+		break;
+	case UClimbAction::Balance_BalanceTurnBack:
+		MontagePlayInofoList = Config.BalanceTurnBack;
+		break;
+	case UClimbAction::NarrowSpace_NarrowSpaceUpToWalk:
+		MontagePlayInofoList = Config.NarrowSpaceUpToWalk;
+		break;
+	case UClimbAction::NarrowSpace_NarrowSpaceDownToWalk:
+		MontagePlayInofoList = Config.NarrowSpaceDownToWalk;
+		break;
+	case UClimbAction::LedgeWalkRight_UpInsideCorner:
+		MontagePlayInofoList = Config.LedgeWalkRightUpInsideCorner;
+		break;
+	case UClimbAction::LedgeWalkRight_DownInsideCorner:
+		MontagePlayInofoList = Config.LedgeWalkRightDownInsideCorner;
+		break;
+	case UClimbAction::LedgeWalkRight_UpOutwardCorner:
+		MontagePlayInofoList = Config.LedgeWalkRightUpOutwardCorner;
+		break;
+	case UClimbAction::LedgeWalkRight_DownOutwardCorner:
+		MontagePlayInofoList = Config.LedgeWalkRightDownOutwardCorner;
+		break;
+	case UClimbAction::LedgeWalkRight_UpLedgeWalkToWalk:
+		MontagePlayInofoList = Config.LedgeWalkRightUpLedgeWalkToWalk;
+		break;
+	case UClimbAction::LedgeWalkRight_DownLedgeWalkToWalk:
+		MontagePlayInofoList = Config.LedgeWalkRightDownLedgeWalkToWalk;
+		break;
+	case UClimbAction::LedgeWalkLeft_UpInsideCorner:
+		MontagePlayInofoList = Config.LedgeWalkLeftUpInsideCorner;
+		break;
+	case UClimbAction::LedgeWalkLeft_DownInsideCorner:
+		MontagePlayInofoList = Config.LedgeWalkLeftDownInsideCorner;
+		break;
+	case UClimbAction::LedgeWalkLeft_UpOutwardCorner:
+		MontagePlayInofoList = Config.LedgeWalkLeftUpOutwardCorner;
+		break;
+	case UClimbAction::LedgeWalkLeft_DownOutwardCorner:
+		MontagePlayInofoList = Config.LedgeWalkLeftDownOutwardCorner;
+		break;
+	case UClimbAction::LedgeWalkLeft_UpLedgeWalkToWalk:
+		MontagePlayInofoList = Config.LedgeWalkLeftUpLedgeWalkToWalk;
+		break;
+	case UClimbAction::LedgeWalkLeft_DownLedgeWalkToWalk:
+		MontagePlayInofoList = Config.LedgeWalkLeftDownLedgeWalkToWalk;
+		break;
+	case UClimbAction::ZipLine_ZipLineGlidingToWalk:
+		MontagePlayInofoList = Config.ZipLineGlidingToWalk;
+		break;
+	case UClimbAction::ZipLine_RightFallToZipLine:
+		MontagePlayInofoList = Config.RightFallToZipLine;
+		break;
+	case UClimbAction::ZipLine_LeftFallToZipLine:
+		MontagePlayInofoList = Config.LeftFallToZipLine;
+		break;
+	default:
+		break;
+	}
+
+	if (MontagePlayInofoList.Num() == 0)
+		return false;
+
+	outMontagePlayInofo = MontagePlayInofoList[FMath::RandRange(0, MontagePlayInofoList.Num() - 1)];
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbMontageLookupBenchmark, "Climbing.Montage.LookupBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FClimbMontageLookupBenchmark::RunTest(const FString& Parameters)
+{
+	int32 Iterations = 1000000;
+	FParse::Value(FCommandLine::Get(), TEXT("ClimbMontageLookupIterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+
+	UClimbMontageAnimConfig* Config = NewObject<UClimbMontageAnimConfig>();
+
+	//Three montages per action like the shipped config, each with a path naming its list so lookups can be told apart
+	for (TFieldIterator<FArrayProperty> PropertyIterator(UClimbMontageAnimConfig::StaticClass()); PropertyIterator; ++PropertyIterator)
+	{
+		FArrayProperty* ArrayProperty = *PropertyIterator;
+		if (CastField<FStructProperty>(ArrayProperty->Inner) == nullptr || CastField<FStructProperty>(ArrayProperty->Inner)->Struct != FMontagePlayInofo::StaticStruct())
+			continue;
+
+		TArray<FMontagePlayInofo>* List = ArrayProperty->ContainerPtrToValuePtr<TArray<FMontagePlayInofo>>(Config);
+		for (int32 i = 0; i < 3; i++)
+		{
+			FString MontageName = FString::Printf(TEXT("%s_%d"), *ArrayProperty->GetName(), i);
+			FMontagePlayInofo& MontagePlayInofo = List->AddDefaulted_GetRef();
+			MontagePlayInofo.AnimMontageToPlay = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(FString::Printf(TEXT("/Game/ClimbTest/%s.%s"), *MontageName, *MontageName)));
+		}
+	}
+
+	FRandomStream RandomStream(0);
+
+	//The table has to pick from the same list the switch did for every action
+	for (int32 ActionIndex = 0; ActionIndex < UClimbMontageAnimConfig::ClimbActionCount; ActionIndex++)
+	{
+		UClimbAction ClimbAction = (UClimbAction)ActionIndex;
+		FString ActionName = StaticEnum<UClimbAction>()->GetNameStringByValue(ActionIndex);
+
+		TConstArrayView<FMontagePlayInofo> List = Config->GetMontagePlayInofoList(ClimbAction);
+
+		FMontagePlayInofo SwitchMontagePlayInofo;
+		if (!TestTrue(*FString::Printf(TEXT("%s has montages in the switch"), *ActionName), SwitchMontagePlayInofoByClimbAction(*Config, ClimbAction, SwitchMontagePlayInofo)))
+			continue;
+
+		const FMontagePlayInofo* MontagePlayInofo = Config->GetMontagePlayInofoByClimbAction(ClimbAction, RandomStream);
+		if (!TestNotNull(*FString::Printf(TEXT("%s has montages in the table"), *ActionName), MontagePlayInofo))
+			continue;
+
+		TestTrue(*FString::Printf(TEXT("%s table lookup points into its list without copying"), *ActionName), MontagePlayInofo >= List.GetData() && MontagePlayInofo < List.GetData() + List.Num());
+		TestTrue(*FString::Printf(TEXT("%s switch picked from the same list"), *ActionName), List.ContainsByPredicate([&SwitchMontagePlayInofo](const FMontagePlayInofo& Entry)
+		{
+			return Entry.AnimMontageToPlay == SwitchMontagePlayInofo.AnimMontageToPlay;
+		}));
+	}
+
+	//Replays rely on the same seed picking the same variations
+	{
+		FRandomStream RecordStream(1234);
+		FRandomStream ReplayStream(1234);
+
+		bool bSamePicks = true;
+		for (int32 i = 0; i < UClimbMontageAnimConfig::ClimbActionCount * 4; i++)
+		{
+			UClimbAction ClimbAction = (UClimbAction)(i % UClimbMontageAnimConfig::ClimbActionCount);
+			bSamePicks &= Config->GetMontagePlayInofoByClimbAction(ClimbAction, RecordStream) == Config->GetMontagePlayInofoByClimbAction(ClimbAction, ReplayStream);
+		}
+
+		TestTrue(TEXT("Streams with the same seed pick the same montages"), bSamePicks);
+	}
+
+	//Cycle through the actions the way bursts of climb checks do
+	uint32 Checksum = 0;
+
+	double SwitchStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		FMontagePlayInofo MontagePlayInofo;
+		if (SwitchMontagePlayInofoByClimbAction(*Config, (UClimbAction)(i % UClimbMontageAnimConfig::ClimbActionCount), MontagePlayInofo))
+			Checksum += MontagePlayInofo.AnimMontageToPlay.IsNull() ? 0 : 1;
+	}
+	double SwitchSeconds = FPlatformTime::Seconds() - SwitchStartTime;
+
+	double TableStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		if (const FMontagePlayInofo* MontagePlayInofo = Config->GetMontagePlayInofoByClimbAction((UClimbAction)(i % UClimbMontageAnimConfig::ClimbActionCount), RandomStream))
+			Checksum += MontagePlayInofo->AnimMontageToPlay.IsNull() ? 0 : 1;
+	}
+	double TableSeconds = FPlatformTime::Seconds() - TableStartTime;
+
+	AddInfo(FString::Printf(TEXT("%d montage lookups: switch %.0f lookups/s (%.1f ns each), table %.0f lookups/s (%.1f ns each), %.1fx (checksum %u)"),
+		Iterations,
+		Iterations / SwitchSeconds, SwitchSeconds * 1e9 / Iterations,
+		Iterations / TableSeconds, TableSeconds * 1e9 / Iterations,
+		SwitchSeconds / TableSeconds, Checksum));
+
+	//Timing on a shared build agent is too noisy to fail on
+	if (TableSeconds >= SwitchSeconds)
+	{
+		AddWarning(TEXT("Table lookup was not faster than the switch"));
+	}
+
+	return true;
+}
+
+#endif
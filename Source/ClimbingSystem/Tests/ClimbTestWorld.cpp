@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbComponent.h"
+#include "EngineUtils.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameMapsSettings.h"
+
+FClimbTestWorld::FClimbTestWorld()
+{
+	//Added to root by CreateWorld, not handed to the engine so it is only ticked by us
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ClimbTestWorld"));
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	//Without a game mode nothing routes BeginPlay to the actors
+	World->GetWorldSettings()->NotifyBeginPlay();
+}
+
+FClimbTestWorld::~FClimbTestWorld()
+{
+	World->BeginTearingDown();
+
+	for (FActorIterator Iterator(World); Iterator; ++Iterator)
+	{
+		Iterator->RouteEndPlay(EEndPlayReason::Destroyed);
+	}
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	World = nullptr;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+AStaticMeshActor* FClimbTestWorld::SpawnCube(const FVector& Location, const FVector& Scale, const FRotator& Rotation)
+{
+	return SpawnMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")), Location, Scale, Rotation);
+}
+
+AStaticMeshActor* FClimbTestWorld::SpawnCylinder(const FVector& Location, const FVector& Scale, const FRotator& Rotation)
+{
+	return SpawnMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cylinder.Cylinder")), Location, Scale, Rotation);
+}
+
+AStaticMeshActor* FClimbTestWorld::SpawnMesh(UStaticMesh* Mesh, const FVector& Location, const FVector& Scale, const FRotator& Rotation)
+{
+	if (Mesh == nullptr)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AStaticMeshActor* Block = World->SpawnActor<AStaticMeshActor>(Location, Rotation, SpawnParameters);
+	if (Block == nullptr)
+		return nullptr;
+
+	//Static components cannot change their mesh once registered
+	Block->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+	Block->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+	Block->SetActorScale3D(Scale);
+
+	return Block;
+}
+
+ACharacter* FClimbTestWorld::SpawnClimber(UClass* ClimberClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (ClimberClass == nullptr || !ClimberClass->IsChildOf(ACharacter::StaticClass()))
+		return nullptr;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ACharacter* Character = World->SpawnActor<ACharacter>(ClimberClass, Location, Rotation, SpawnParameters);
+	if (Character == nullptr)
+		return nullptr;
+
+	if (Character->FindComponentByClass<UClimbComponent>() == nullptr)
+	{
+		Character->Destroy();
+		return nullptr;
+	}
+
+	//Character movement only simulates possessed characters
+	if (Character->GetController() == nullptr)
+	{
+		Character->SpawnDefaultController();
+	}
+
+	if (AController* Controller = Character->GetController())
+	{
+		Controller->SetControlRotation(Rotation);
+	}
+
+	return Character;
+}
+
+AActor* FClimbTestWorld::SpawnActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (ActorClass == nullptr)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParameters);
+}
+
+void FClimbTestWorld::Tick(float DeltaTime)
+{
+	World->Tick(LEVELTICK_All, DeltaTime);
+}
+
+UClass* FClimbTestWorld::GetClimberClass()
+{
+	UClass* GameModeClass = LoadClass<AGameModeBase>(nullptr, *UGameMapsSettings::GetGlobalDefaultGameMode());
+	if (GameModeClass == nullptr)
+		return nullptr;
+
+	return GameModeClass->GetDefaultObject<AGameModeBase>()->DefaultPawnClass;
+}
+
+UClass* FClimbTestWorld::GetZipLineClass()
+{
+	return LoadClass<AActor>(nullptr, TEXT("/Game/ThirdPerson/Blueprints/ZipLine/BP_ZipLine.BP_ZipLine_C"));
+}
+
+#endif
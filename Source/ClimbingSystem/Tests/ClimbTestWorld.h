@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class ACharacter;
+class AStaticMeshActor;
+class UClimbComponent;
+
+/**
+ * Empty game world for climbing automation tests, without a game mode or players.
+ * It is not known to the engine, so it only ticks when Tick is called, which keeps runs repeatable and works under -nullrhi.
+ */
+class FClimbTestWorld
+{
+public:
+	FClimbTestWorld();
+	~FClimbTestWorld();
+
+	UWorld* GetWorld() const { return World; }
+
+	/** Engine basic shapes are 100 units across and centered on their pivot. */
+	AStaticMeshActor* SpawnCube(const FVector& Location, const FVector& Scale, const FRotator& Rotation = FRotator::ZeroRotator);
+	AStaticMeshActor* SpawnCylinder(const FVector& Location, const FVector& Scale, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	/** Spawns a climber of ClimberClass with an AI controller, nullptr when it has no UClimbComponent. */
+	ACharacter* SpawnClimber(UClass* ClimberClass, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	AActor* SpawnActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	void Tick(float DeltaTime);
+
+	/** Default pawn of the project's default game mode, the character the climbing system ships with. */
+	static UClass* GetClimberClass();
+
+	/** Zip line the project ships with, an IIZipSystem actor. */
+	static UClass* GetZipLineClass();
+
+private:
+	AStaticMeshActor* SpawnMesh(class UStaticMesh* Mesh, const FVector& Location, const FVector& Scale, const FRotator& Rotation);
+
+	UWorld* World = nullptr;
+};
+
+#endif
@@ -0,0 +1,279 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbComponent.h"
+#include "TraceBlueprintFunctionLibrary.h"
+#include "EngineUtils.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameMapsSettings.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/AutomationTest.h"
+
+/** Allocation count of the scope open on this thread, allocations of other threads never see it. */
+static thread_local int32* GClimbAllocationCount = nullptr;
+
+/**
+ * Forwards to the allocator it wraps, counting the allocations of threads with an open FClimbScopedAllocationCounter.
+ * Installed once and never removed or freed, so a thread that read GMalloc before or while it was installed keeps a valid allocator.
+ */
+class FClimbAllocationHook final : public FMalloc
+{
+public:
+	static void Install()
+	{
+		check(IsInGameThread());
+
+		static FClimbAllocationHook* Hook = nullptr;
+		if (Hook != nullptr)
+			return;
+
+		Hook = new FClimbAllocationHook(GMalloc);
+		FPlatformAtomics::InterlockedExchangePtr((void**)&GMalloc, Hook);
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return Inner->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+			CountAllocation();
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+			CountAllocation();
+		return Inner->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+private:
+	explicit FClimbAllocationHook(FMalloc* InInner)
+		: Inner(InInner)
+	{
+	}
+
+	static void CountAllocation()
+	{
+		if (GClimbAllocationCount != nullptr)
+			(*GClimbAllocationCount)++;
+	}
+
+	FMalloc* Inner;
+};
+
+/** Counts the heap allocations of the calling thread while in scope. */
+struct FClimbScopedAllocationCounter
+{
+	FClimbScopedAllocationCounter()
+	{
+		check(GClimbAllocationCount == nullptr);
+
+		FClimbAllocationHook::Install();
+		GClimbAllocationCount = &Allocations;
+	}
+
+	~FClimbScopedAllocationCounter()
+	{
+		Stop();
+	}
+
+	int32 Stop()
+	{
+		if (GClimbAllocationCount == &Allocations)
+			GClimbAllocationCount = nullptr;
+		return Allocations;
+	}
+
+private:
+	int32 Allocations = 0;
+};
+
+/** Game world only ticked by the test, with a floor, a wall in front of the climber and the project's default pawn. */
+struct FClimbAllocationTestWorld
+{
+	FClimbAllocationTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ClimbTraceAllocationTest"));
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		//Without a game mode nothing routes BeginPlay to the actors
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	~FClimbAllocationTestWorld()
+	{
+		World->BeginTearingDown();
+
+		for (FActorIterator Iterator(World); Iterator; ++Iterator)
+		{
+			Iterator->RouteEndPlay(EEndPlayReason::Destroyed);
+		}
+
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	void SpawnCube(const FVector& Location, const FVector& Scale)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AStaticMeshActor* Block = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator, SpawnParameters);
+
+		//Static components cannot change their mesh once registered
+		Block->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Block->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		Block->SetActorScale3D(Scale);
+	}
+
+	ACharacter* SpawnClimber(const FVector& Location)
+	{
+		UClass* GameModeClass = LoadClass<AGameModeBase>(nullptr, *UGameMapsSettings::GetGlobalDefaultGameMode());
+		if (GameModeClass == nullptr)
+			return nullptr;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		UClass* PawnClass = GameModeClass->GetDefaultObject<AGameModeBase>()->DefaultPawnClass;
+		ACharacter* Character = PawnClass != nullptr && PawnClass->IsChildOf(ACharacter::StaticClass()) ? World->SpawnActor<ACharacter>(PawnClass, Location, FRotator::ZeroRotator, SpawnParameters) : nullptr;
+		if (Character == nullptr || Character->FindComponentByClass<UClimbComponent>() == nullptr)
+			return nullptr;
+
+		//Character movement only simulates possessed characters
+		if (Character->GetController() == nullptr)
+		{
+			Character->SpawnDefaultController();
+		}
+
+		return Character;
+	}
+
+	void Tick(float DeltaTime)
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	UWorld* World = nullptr;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbTraceAllocationTest, "Climbing.Trace.NoAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FClimbTraceAllocationTest::RunTest(const FString& Parameters)
+{
+	FClimbAllocationTestWorld TestWorld;
+
+	//Floor with a wall in front of the climber, so detection traces hit as well as miss
+	TestWorld.SpawnCube(FVector(0, 0, -10), FVector(20, 20, 0.2));
+	TestWorld.SpawnCube(FVector(150, 0, 200), FVector(1, 10, 4));
+
+	ACharacter* Character = TestWorld.SpawnClimber(FVector(0, 0, 100));
+	if (!TestNotNull(TEXT("Climber spawned"), Character))
+		return false;
+
+	UClimbComponent* ClimbComponent = Character->FindComponentByClass<UClimbComponent>();
+
+	//Land, and let first use allocations like stat registration and query buffers happen before measuring
+	for (int32 Frame = 0; Frame < 60; Frame++)
+	{
+		TestWorld.Tick(1.0f / 60);
+	}
+
+	TestEqual(TEXT("Climber is in the default state"), ClimbComponent->GetClimbState(), UClimbState::Default);
+	TestEqual(TEXT("Climber is walking"), Character->GetCharacterMovement()->MovementMode.GetValue(), MOVE_Walking);
+
+	//The native trace helpers on cached query params and caller owned hits
+	{
+		UWorld* World = TestWorld.World;
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbTraceAllocationTest), false);
+		QueryParams.AddIgnoredActor(Character);
+
+		FVector Start = Character->GetActorLocation();
+		FVector End = Start + FVector(300, 0, 0);
+
+		FTraceRequest Requests[4];
+		for (int32 i = 0; i < UE_ARRAY_COUNT(Requests); i++)
+		{
+			Requests[i].Start = Start + FVector(0, 0, i * 40);
+			Requests[i].End = End + FVector(0, 0, i * 40);
+			Requests[i].Shape = (ETraceShape)i;
+			Requests[i].Radius = 10;
+			Requests[i].HalfHeight = 20;
+		}
+
+		FHitResult HitResult;
+		FTraceHitRecord HitRecords[UE_ARRAY_COUNT(Requests)];
+
+		auto RunTraces = [&]()
+		{
+			UTraceBlueprintFunctionLibrary::LineTrace(World, Start, End, QueryParams, HitResult);
+			UTraceBlueprintFunctionLibrary::SphereTrace(World, Start, End, 10, QueryParams, HitResult);
+			UTraceBlueprintFunctionLibrary::BoxTrace(World, Start, End, FRotator::ZeroRotator, 10, QueryParams, HitResult);
+			UTraceBlueprintFunctionLibrary::CapsuleTrace(World, Start, End, FRotator::ZeroRotator, 20, 10, QueryParams, HitResult);
+			UTraceBlueprintFunctionLibrary::BatchTrace(World, Requests, QueryParams, HitRecords);
+		};
+
+		RunTraces();
+
+		FClimbScopedAllocationCounter AllocationCounter;
+		for (int32 i = 0; i < 100; i++)
+		{
+			RunTraces();
+		}
+		int32 Allocations = AllocationCounter.Stop();
+
+		TestEqual(TEXT("Heap allocations of 100 rounds of native trace helpers"), Allocations, 0);
+	}
+
+	//A whole default state tick with its detection pass, past every detection interval so the pass is not skipped
+	{
+		const float DeltaTime = 0.25f;
+		ClimbComponent->TickComponent(DeltaTime, LEVELTICK_All, &ClimbComponent->PrimaryComponentTick);
+
+		FClimbScopedAllocationCounter AllocationCounter;
+		for (int32 i = 0; i < 10; i++)
+		{
+			ClimbComponent->TickComponent(DeltaTime, LEVELTICK_All, &ClimbComponent->PrimaryComponentTick);
+		}
+		int32 Allocations = AllocationCounter.Stop();
+
+		TestEqual(TEXT("Heap allocations of 10 default state ticks"), Allocations, 0);
+	}
+
+	return true;
+}
+
+#endif
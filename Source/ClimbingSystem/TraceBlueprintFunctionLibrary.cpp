@@ -2,6 +2,8 @@
 
 
 #include "TraceBlueprintFunctionLibrary.h"
+#include "ClimbStats.h"
+#include "ClimbTelemetry.h"
 #include "Engine/Private/KismetTraceUtils.h"
 
 void UTraceBlueprintFunctionLibrary::FindDeltaAngleDegrees(float StartAngle, float TargetAngle, float& DeltaAngle)
@@ -19,51 +21,97 @@ FHitResult UTraceBlueprintFunctionLibrary::LineTrace(const AActor* TraceContext,
 {
 	FHitResult hitResult;
 
-	//FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic) | ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldDynamic));
-	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic));
+	FCollisionQueryParams CollisionQueryParams;
+	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+
+	LineTrace(TraceContext->GetWorld(), start, end, CollisionQueryParams, hitResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+
+	return hitResult;
+}
+
+FHitResult UTraceBlueprintFunctionLibrary::SphereTrace(const AActor* TraceContext, const FVector& start, const FVector& end, float radius,const TArray<AActor*>& InIgnoreActors, bool DebugDraw /*= false*/, FLinearColor TraceColor /*= FLinearColor::Red*/, FLinearColor TraceHitColor /*= FLinearColor::Green*/, float DrawDuration /*= 0*/, ECollisionChannel CollisionChannel /*ECollisionChannel::ECC_WorldStatic*/)
+{
+	FHitResult hitResult;
+
+	FCollisionQueryParams CollisionQueryParams;
+	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+
+	SphereTrace(TraceContext->GetWorld(), start, end, radius, CollisionQueryParams, hitResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration, CollisionChannel);
+
+	return hitResult;
+}
+
+FHitResult UTraceBlueprintFunctionLibrary::BoxTrace(const AActor* TraceContext, const FVector& start, const FVector& end, FRotator rotation, float HalfExtent, const TArray<AActor*>& InIgnoreActors, bool DebugDraw /*= false*/, FLinearColor TraceColor /*= FLinearColor::Red*/, FLinearColor TraceHitColor /*= FLinearColor::Green*/, float DrawDuration /*= 0*/)
+{
+	FHitResult hitResult;
 
 	FCollisionQueryParams CollisionQueryParams;
 	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
 
-	bool bHit = TraceContext->GetWorld()->LineTraceSingleByObjectType(hitResult, start, end, CollisionObjectQueryParams, CollisionQueryParams);
+	BoxTrace(TraceContext->GetWorld(), start, end, rotation, HalfExtent, CollisionQueryParams, hitResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+
+	return hitResult;
+}
+
+FHitResult UTraceBlueprintFunctionLibrary::CapsuleTrace(const AActor* TraceContext, const FVector& start, const FVector& end, FRotator rotation, float CapsuleHalfHeight, float CapsuleRadius, const TArray<AActor*>& InIgnoreActors, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration )
+{
+	FHitResult hitResult;
+
+	FCollisionQueryParams CollisionQueryParams;
+	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+
+	CapsuleTrace(TraceContext->GetWorld(), start, end, rotation, CapsuleHalfHeight, CapsuleRadius, CollisionQueryParams, hitResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+
+	return hitResult;
+}
+
+bool UTraceBlueprintFunctionLibrary::LineTrace(const UWorld* World, const FVector& start, const FVector& end, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	INC_DWORD_STAT(STAT_ClimbLineTraces);
+
+	//FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic) | ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldDynamic));
+	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic));
+
+	bool bHit = World->LineTraceSingleByObjectType(OutHitResult, start, end, CollisionObjectQueryParams, CollisionQueryParams);
+
+	FClimbTelemetryScope::RecordTrace(ETraceShape::Line, bHit);
 
 	if (DebugDraw)
 	{
 #if ENABLE_DRAW_DEBUG
-		DrawDebugLineTraceSingle(TraceContext->GetWorld(), hitResult.TraceStart, hitResult.TraceEnd, EDrawDebugTrace::ForDuration, bHit, hitResult, TraceColor, TraceHitColor, DrawDuration);
+		DrawDebugLineTraceSingle(World, OutHitResult.TraceStart, OutHitResult.TraceEnd, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
 #endif
 	}
 
-	return hitResult;
+	return bHit;
 }
 
-FHitResult UTraceBlueprintFunctionLibrary::SphereTrace(const AActor* TraceContext, const FVector& start, const FVector& end, float radius,const TArray<AActor*>& InIgnoreActors, bool DebugDraw /*= false*/, FLinearColor TraceColor /*= FLinearColor::Red*/, FLinearColor TraceHitColor /*= FLinearColor::Green*/, float DrawDuration /*= 0*/, ECollisionChannel CollisionChannel /*ECollisionChannel::ECC_WorldStatic*/)
+bool UTraceBlueprintFunctionLibrary::SphereTrace(const UWorld* World, const FVector& start, const FVector& end, float radius, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration, ECollisionChannel CollisionChannel)
 {
-	FHitResult hitResult;
+	INC_DWORD_STAT(STAT_ClimbSphereTraces);
 
 	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(CollisionChannel));
 
 	FCollisionShape CollisionShape;
 	CollisionShape.SetSphere(radius);
 
-	FCollisionQueryParams CollisionQueryParams;
-	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+	bool bHit = World->SweepSingleByObjectType(OutHitResult, start, end, FQuat::Identity, CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
 
-	bool bHit = TraceContext->GetWorld()->SweepSingleByObjectType(hitResult, start, end, FQuat::Identity, CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
+	FClimbTelemetryScope::RecordTrace(ETraceShape::Sphere, bHit);
 
 	if (DebugDraw)
 	{
 #if ENABLE_DRAW_DEBUG
-		DrawDebugSphereTraceSingle(TraceContext->GetWorld(), start, end,radius, EDrawDebugTrace::ForDuration, bHit,hitResult, TraceColor, TraceHitColor, DrawDuration);
+		DrawDebugSphereTraceSingle(World, start, end,radius, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
 #endif
 	}
 
-	return hitResult;
+	return bHit;
 }
 
-FHitResult UTraceBlueprintFunctionLibrary::BoxTrace(const AActor* TraceContext, const FVector& start, const FVector& end, FRotator rotation, float HalfExtent, const TArray<AActor*>& InIgnoreActors, bool DebugDraw /*= false*/, FLinearColor TraceColor /*= FLinearColor::Red*/, FLinearColor TraceHitColor /*= FLinearColor::Green*/, float DrawDuration /*= 0*/)
+bool UTraceBlueprintFunctionLibrary::BoxTrace(const UWorld* World, const FVector& start, const FVector& end, FRotator rotation, float HalfExtent, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
 {
-	FHitResult hitResult;
+	INC_DWORD_STAT(STAT_ClimbBoxTraces);
 
 	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic));
 
@@ -71,42 +119,208 @@ FHitResult UTraceBlueprintFunctionLibrary::BoxTrace(const AActor* TraceContext,
 	//CollisionShape.SetBox(FVector3f(HalfExtent));
 	CollisionShape.SetBox(FVector3f(HalfExtent,HalfExtent, HalfExtent));
 
-	FCollisionQueryParams CollisionQueryParams;
-	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+	bool bHit = World->SweepSingleByObjectType(OutHitResult, start, end, rotation.Quaternion(), CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
 
-	bool bHit = TraceContext->GetWorld()->SweepSingleByObjectType(hitResult, start, end, rotation.Quaternion(), CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
+	FClimbTelemetryScope::RecordTrace(ETraceShape::Box, bHit);
 
 	if (DebugDraw)
 	{
 #if ENABLE_DRAW_DEBUG
-		DrawDebugBoxTraceSingle(TraceContext->GetWorld(),start,end,FVector(HalfExtent), rotation, EDrawDebugTrace::ForDuration, bHit, hitResult, TraceColor, TraceHitColor, DrawDuration);
+		DrawDebugBoxTraceSingle(World,start,end,FVector(HalfExtent), rotation, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
 #endif
 	}
 
-	return hitResult;
+	return bHit;
 }
 
-FHitResult UTraceBlueprintFunctionLibrary::CapsuleTrace(const AActor* TraceContext, const FVector& start, const FVector& end, FRotator rotation, float CapsuleHalfHeight, float CapsuleRadius, const TArray<AActor*>& InIgnoreActors, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration )
+bool UTraceBlueprintFunctionLibrary::CapsuleTrace(const UWorld* World, const FVector& start, const FVector& end, FRotator rotation, float CapsuleHalfHeight, float CapsuleRadius, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
 {
-	FHitResult hitResult;
+	INC_DWORD_STAT(STAT_ClimbCapsuleTraces);
 
 	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(ECollisionChannel::ECC_WorldStatic));
 
 	FCollisionShape CollisionShape;
 	CollisionShape.SetCapsule(CapsuleRadius, CapsuleHalfHeight);
 
-	FCollisionQueryParams CollisionQueryParams;
-	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+	bool bHit = World->SweepSingleByObjectType(OutHitResult, start, end, rotation.Quaternion(), CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
 
-	bool bHit = TraceContext->GetWorld()->SweepSingleByObjectType(hitResult, start, end, rotation.Quaternion(), CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
+	FClimbTelemetryScope::RecordTrace(ETraceShape::Capsule, bHit);
 
 	if (DebugDraw)
 	{
 #if ENABLE_DRAW_DEBUG
-	DrawDebugCapsuleTraceSingle(TraceContext->GetWorld(), start,end, CapsuleRadius,CapsuleHalfHeight, EDrawDebugTrace::ForDuration, bHit, hitResult, TraceColor, TraceHitColor, DrawDuration);
+		DrawDebugCapsuleTraceSingle(World, start,end, CapsuleRadius,CapsuleHalfHeight, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
 #endif
 	}
 
-	return hitResult;
+	return bHit;
+}
+
+void UTraceBlueprintFunctionLibrary::BatchTrace(const AActor* TraceContext, const TArray<FTraceRequest>& Requests, const TArray<AActor*>& InIgnoreActors, TArray<FTraceHitRecord>& OutHitRecords, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	OutHitRecords.SetNum(Requests.Num());
+
+	BatchTrace(TraceContext, TConstArrayView<FTraceRequest>(Requests), InIgnoreActors, TArrayView<FTraceHitRecord>(OutHitRecords), DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+}
+
+void UTraceBlueprintFunctionLibrary::BatchTrace(const AActor* TraceContext, TConstArrayView<FTraceRequest> Requests, const TArray<AActor*>& InIgnoreActors, TArrayView<FTraceHitRecord> OutHitRecords, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	FCollisionQueryParams CollisionQueryParams(SCENE_QUERY_STAT(ClimbBatchTrace), false);
+	CollisionQueryParams.AddIgnoredActors(InIgnoreActors);
+
+	BatchTrace(TraceContext->GetWorld(), Requests, CollisionQueryParams, OutHitRecords, DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+}
+
+void UTraceBlueprintFunctionLibrary::BatchTrace(const UWorld* World, TConstArrayView<FTraceRequest> Requests, const FCollisionQueryParams& CollisionQueryParams, TArrayView<FTraceHitRecord> OutHitRecords, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	check(OutHitRecords.Num() >= Requests.Num());
+
+	FHitResult hitResult;
+
+	for (int32 i = 0; i < Requests.Num(); i++)
+	{
+		TraceSingle(World, Requests[i], CollisionQueryParams, hitResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration);
+
+		OutHitRecords[i] = MakeTraceHitRecord(hitResult);
+	}
 }
 
+FTraceHitRecord UTraceBlueprintFunctionLibrary::MakeTraceHitRecord(const FHitResult& HitResult)
+{
+	FTraceHitRecord HitRecord;
+	HitRecord.bBlockingHit = HitResult.bBlockingHit;
+	HitRecord.Location = HitResult.Location;
+	HitRecord.ImpactPoint = HitResult.ImpactPoint;
+	HitRecord.Normal = HitResult.Normal;
+	HitRecord.ImpactNormal = HitResult.ImpactNormal;
+	HitRecord.Distance = HitResult.Distance;
+	HitRecord.Actor = HitResult.GetActor();
+
+	return HitRecord;
+}
+
+bool UTraceBlueprintFunctionLibrary::FindEdgeExtent(const UWorld* World, const FVector& start, const FVector& end, const FVector& Direction, float MaxDistance, float Step, float Precision, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutLastHit, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	check(Step > 0 && Precision > 0);
+
+	FHitResult TraceResult;
+
+	//The surface has to start right next to the probe, like the first step of the fixed step scans
+	float HitDistance = FMath::Min(Step, MaxDistance);
+	if (!LineTrace(World, start + Direction * HitDistance, end + Direction * HitDistance, CollisionQueryParams, TraceResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration))
+		return false;
+
+	OutLastHit = TraceResult;
+
+	//Coarse steps up to MaxDistance, every one has to hit so a gap the coarse steps land in ends the surface
+	const float CoarseStep = Step * 4;
+	float MissDistance = 0;
+
+	for (float Distance = CoarseStep; HitDistance < MaxDistance; Distance += CoarseStep)
+	{
+		Distance = FMath::Min(Distance, MaxDistance);
+
+		if (!LineTrace(World, start + Direction * Distance, end + Direction * Distance, CollisionQueryParams, TraceResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration))
+		{
+			MissDistance = Distance;
+			break;
+		}
+
+		HitDistance = Distance;
+		OutLastHit = TraceResult;
+	}
+
+	if (MissDistance == 0)
+		return true;
+
+	//The edge lies between the last hit and the first miss, narrow it down
+	while (MissDistance - HitDistance > Precision)
+	{
+		float Distance = (HitDistance + MissDistance) * 0.5f;
+
+		if (LineTrace(World, start + Direction * Distance, end + Direction * Distance, CollisionQueryParams, TraceResult, DebugDraw, TraceColor, TraceHitColor, DrawDuration))
+		{
+			HitDistance = Distance;
+			OutLastHit = TraceResult;
+		}
+		else
+		{
+			MissDistance = Distance;
+		}
+	}
+
+	return true;
+}
+
+bool UTraceBlueprintFunctionLibrary::TraceSingle(const UWorld* World, const FTraceRequest& Request, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration)
+{
+	OutHitResult.Init(Request.Start, Request.End);
+
+	FCollisionObjectQueryParams CollisionObjectQueryParams(ECC_TO_BITFIELD(Request.CollisionChannel.GetValue()));
+
+	FCollisionShape CollisionShape;
+	switch (Request.Shape)
+	{
+	case ETraceShape::Sphere:
+		CollisionShape.SetSphere(Request.Radius);
+		break;
+	case ETraceShape::Box:
+		CollisionShape.SetBox(FVector3f(Request.Radius, Request.Radius, Request.Radius));
+		break;
+	case ETraceShape::Capsule:
+		CollisionShape.SetCapsule(Request.Radius, Request.HalfHeight);
+		break;
+	case ETraceShape::Line:
+	default:
+		break;
+	}
+
+#if STATS
+	switch (Request.Shape)
+	{
+	case ETraceShape::Sphere:
+		INC_DWORD_STAT(STAT_ClimbSphereTraces);
+		break;
+	case ETraceShape::Box:
+		INC_DWORD_STAT(STAT_ClimbBoxTraces);
+		break;
+	case ETraceShape::Capsule:
+		INC_DWORD_STAT(STAT_ClimbCapsuleTraces);
+		break;
+	case ETraceShape::Line:
+	default:
+		INC_DWORD_STAT(STAT_ClimbLineTraces);
+		break;
+	}
+#endif
+
+	bool bHit = (Request.Shape == ETraceShape::Line) ?
+		World->LineTraceSingleByObjectType(OutHitResult, Request.Start, Request.End, CollisionObjectQueryParams, CollisionQueryParams) :
+		World->SweepSingleByObjectType(OutHitResult, Request.Start, Request.End, Request.Rotation.Quaternion(), CollisionObjectQueryParams, CollisionShape, CollisionQueryParams);
+
+	FClimbTelemetryScope::RecordTrace(Request.Shape, bHit);
+
+	if (DebugDraw)
+	{
+#if ENABLE_DRAW_DEBUG
+		switch (Request.Shape)
+		{
+		case ETraceShape::Sphere:
+			DrawDebugSphereTraceSingle(World, Request.Start, Request.End, Request.Radius, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
+			break;
+		case ETraceShape::Box:
+			DrawDebugBoxTraceSingle(World, Request.Start, Request.End, FVector(Request.Radius), Request.Rotation, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
+			break;
+		case ETraceShape::Capsule:
+			DrawDebugCapsuleTraceSingle(World, Request.Start, Request.End, Request.Radius, Request.HalfHeight, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
+			break;
+		case ETraceShape::Line:
+		default:
+			DrawDebugLineTraceSingle(World, Request.Start, Request.End, EDrawDebugTrace::ForDuration, bHit, OutHitResult, TraceColor, TraceHitColor, DrawDuration);
+			break;
+		}
+#endif
+	}
+
+	return bHit;
+}
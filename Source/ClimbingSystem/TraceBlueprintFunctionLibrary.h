@@ -6,6 +6,73 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "TraceBlueprintFunctionLibrary.generated.h"
 
+UENUM(BlueprintType)
+enum class ETraceShape : uint8
+{
+	Line,
+	Sphere,
+	Box,
+	Capsule
+};
+
+/** One probe of a batched trace pass. Radius is the box half extent for box traces. */
+USTRUCT(BlueprintType)
+struct FTraceRequest
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ETraceShape Shape = ETraceShape::Line;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector Start = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector End = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float HalfHeight = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+};
+
+/** Compact result of one probe of a batched trace pass. */
+USTRUCT(BlueprintType)
+struct FTraceHitRecord
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly)
+	bool bBlockingHit = false;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector ImpactPoint = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector Normal = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	FVector ImpactNormal = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	float Distance = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	AActor* Actor = nullptr;
+};
+
 /**
  * 
  */
@@ -32,4 +99,32 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	static FHitResult CapsuleTrace(const AActor* TraceContext, const FVector& start, const FVector& end, FRotator rotation, float CapsuleHalfHeight, float CapsuleRadius,const TArray<AActor*>& InIgnoreActors, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+	/** Native variants for hot paths: the caller owns a prebuilt FCollisionQueryParams and the hit storage, so no ignore list or hit result is copied per call. */
+	static bool LineTrace(const UWorld* World, const FVector& start, const FVector& end, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+	static bool SphereTrace(const UWorld* World, const FVector& start, const FVector& end, float radius, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0, ECollisionChannel CollisionChannel = ECollisionChannel::ECC_WorldStatic);
+	static bool BoxTrace(const UWorld* World, const FVector& start, const FVector& end, FRotator rotation, float HalfExtent, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+	static bool CapsuleTrace(const UWorld* World, const FVector& start, const FVector& end, FRotator rotation, float CapsuleHalfHeight, float CapsuleRadius, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+	/** Runs every request against the same query params, built once for the whole pass. OutHitRecords matches Requests index for index. */
+	UFUNCTION(BlueprintCallable)
+	static void BatchTrace(const AActor* TraceContext, const TArray<FTraceRequest>& Requests, const TArray<AActor*>& InIgnoreActors, TArray<FTraceHitRecord>& OutHitRecords, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+	/** Native variant for callers that keep requests and results in their own (e.g. stack) storage. OutHitRecords must be at least as long as Requests. */
+	static void BatchTrace(const AActor* TraceContext, TConstArrayView<FTraceRequest> Requests, const TArray<AActor*>& InIgnoreActors, TArrayView<FTraceHitRecord> OutHitRecords, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+	static void BatchTrace(const UWorld* World, TConstArrayView<FTraceRequest> Requests, const FCollisionQueryParams& CollisionQueryParams, TArrayView<FTraceHitRecord> OutHitRecords, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+	static FTraceHitRecord MakeTraceHitRecord(const FHitResult& HitResult);
+
+	/**
+	 * Slides a line trace from start/end along Direction and finds how far the surface reaches, up to MaxDistance. After a first
+	 * trace at Step it moves in coarse steps of 4 * Step and stops at the first miss, so a gap ends the surface when a coarse step
+	 * lands in it; narrower notches between two coarse steps are stepped over. The span between the last hit and that miss is then
+	 * bisected down to Precision. Returns false, leaving OutLastHit untouched, when the trace at Step misses.
+	 */
+	static bool FindEdgeExtent(const UWorld* World, const FVector& start, const FVector& end, const FVector& Direction, float MaxDistance, float Step, float Precision, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutLastHit, bool DebugDraw = false, FLinearColor TraceColor = FLinearColor::Red, FLinearColor TraceHitColor = FLinearColor::Green, float DrawDuration = 0);
+
+private:
+	static bool TraceSingle(const UWorld* World, const FTraceRequest& Request, const FCollisionQueryParams& CollisionQueryParams, FHitResult& OutHitResult, bool DebugDraw, FLinearColor TraceColor, FLinearColor TraceHitColor, float DrawDuration);
 };